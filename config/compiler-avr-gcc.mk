@@ -4,11 +4,13 @@ AR = avr-ar
 NM = avr-nm
 SIZE = avr-size
 LOADER = avrdude
+SIMAVR = simavr
 
 LIBPREFIX := lib
 LIBEXT := .a
 
 CDEFS = PCB=$(PCB)
+CDEFS += $(USER_CDEFS)
 
 ARFLAGS = rcs
 
@@ -0,0 +1,36 @@
+CC = gcc
+LD = gcc
+AR = ar
+NM = nm
+SIZE = size
+
+LIBPREFIX := lib
+LIBEXT := .a
+
+CDEFS = PCB=$(PCB)
+CDEFS += HOST
+CDEFS += _DEFAULT_SOURCE
+CDEFS += $(USER_CDEFS)
+
+ARFLAGS = rcs
+
+CFLAGS = -c
+CFLAGS += -Wall
+CFLAGS += -Werror
+CFLAGS += -Wundef
+CFLAGS += -Wpedantic
+CFLAGS += -fdata-sections
+CFLAGS += -ffunction-sections
+CFLAGS += -O2
+CFLAGS += -g
+CFLAGS += -std=c99
+CFLAGS += $(addprefix -I,$(INCLUDE_DIR))
+CFLAGS += $(addprefix -D,$(CDEFS))
+CFLAGS += -Wa,-adhlns=$(OBJECTS_DIR)/$(@F).lst
+CFLAGS += -o $(OBJECTS_DIR)/$(@F)
+
+
+LDFLAGS += -Wl,-Map,$(BIN_DIR_FORMATED)$(DELIM)$(OUTPUT).map
+LDFLAGS += -Wl,--cref
+LDFLAGS += -Wl,--gc-sections
+LDFLAGS += -Wl,-L$(LIB_DIR)
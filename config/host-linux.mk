@@ -9,4 +9,5 @@ DELIM := /
 GREP := grep
 HEAD := head
 CMDQUIET := >/dev/null 2>&1
+PYTHON := python3
 
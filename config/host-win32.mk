@@ -8,4 +8,5 @@ SED := sed\bin\sed.exe
 DELIM := \ 
 DELIM := $(strip $(DELIM))
 CMDQUIET := >nul 2>nul & verify>nul
+PYTHON := python
 
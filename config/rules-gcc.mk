@@ -5,7 +5,7 @@ OBJECTS_DIR := $(BUILD_DIR)$(CURDIR_RELATIVE)
 
 OBJECTS := $(addsuffix .o,$(basename $(SOURCE)))
 
-INCLUDE_DIR += ../../projects/$(PROJECT) $(patsubst %,../../%,$(GLOBAL_INCLUDE_DIR))
+INCLUDE_DIR += $(PROJECT_DIR)/projects/$(PROJECT) $(patsubst %,$(PROJECT_DIR)/%,$(GLOBAL_INCLUDE_DIR))
 
 vpath
 vpath %.c 		$(subst  ,:,$(SOURCE_DIR))
@@ -0,0 +1,72 @@
+/*!
+ * \file
+ * \brief Host stand-in of 1-wire driver header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup 1wire
+ * \ingroup host
+ * \brief Bus with DS18B20 sensors modelled at the bit level, so ROM search,
+ * addressing and conversion timing behave like on the real bus
+ */
+
+/*@{*/
+
+#define WIRE_HOST_MAX_SENSORS   (4U)
+
+void WIRE_configure(void);
+
+/*!
+ * \brief Performs reset pulse
+ *
+ * \retval true presence pulse detected
+ * \retval false nobody answered
+ */
+bool WIRE_reset(void);
+
+void WIRE_send_bit(bool bit);
+bool WIRE_read_bit(void);
+void WIRE_send_byte(uint8_t data);
+uint8_t WIRE_read_byte(void);
+
+/*!
+ * \brief Sets the number of sensors attached to the bus
+ *
+ * \param count number of sensors, up to WIRE_HOST_MAX_SENSORS
+ */
+void WIRE_HOST_set_sensors_count(uint8_t count);
+
+/*!
+ * \brief Sets temperature which sensor is going to measure
+ *
+ * \param sensor index of the sensor, in the order of ROM codes
+ * \param raw temperature in DS18B20 format, 1/16 of degree Celsius
+ */
+void WIRE_HOST_set_temperature(uint8_t sensor, int16_t raw);
+
+/*@}*/
+#endif /* end of WIRE_H */
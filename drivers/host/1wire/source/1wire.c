@@ -0,0 +1,513 @@
+/*!
+ * \file
+ * \brief Host stand-in of 1-wire driver implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "1wire.h"
+#include "host.h"
+#include <string.h>
+
+#define ROM_SIZE                    (8U)
+#define ROM_BITS                    (ROM_SIZE * 8U)
+#define SCRATCHPAD_SIZE             (9U)
+#define WRITE_SCRATCHPAD_SIZE       (3U)
+
+#define FAMILY_DS18B20              (0x28U)
+
+#define CMD_SEARCH_ROM              (0xF0U)
+#define CMD_ALARM_SEARCH            (0xECU)
+#define CMD_READ_ROM                (0x33U)
+#define CMD_MATCH_ROM               (0x55U)
+#define CMD_SKIP_ROM                (0xCCU)
+#define CMD_CONVERT_T               (0x44U)
+#define CMD_READ_SCRATCHPAD         (0xBEU)
+#define CMD_WRITE_SCRATCHPAD        (0x4EU)
+#define CMD_COPY_SCRATCHPAD         (0x48U)
+#define CMD_RECALL_EEPROM           (0xB8U)
+#define CMD_READ_POWER_SUPPLY       (0xB4U)
+
+#define SP_TEMP_LSB                 (0U)
+#define SP_TEMP_MSB                 (1U)
+#define SP_TH                       (2U)
+#define SP_TL                       (3U)
+#define SP_CONFIG                   (4U)
+#define SP_CRC                      (8U)
+
+#define CONFIG_RESOLUTION_SHIFT     (5U)
+#define CONFIG_RESOLUTION_MASK      (0x03U)
+#define CONFIG_RESERVED_BITS        (0x1FU)
+
+#define POWER_ON_TEMPERATURE        (0x0550)
+#define CONVERSION_TIME_9BIT_MS     (94U)
+
+/* bus timing, so the bus traffic costs the time it costs on the target */
+#define RESET_TIME_US               (960U)
+#define SLOT_TIME_US                (70U)
+
+typedef enum
+{
+    PHASE_IDLE,
+    PHASE_ROM_COMMAND,
+    PHASE_MATCH_ROM,
+    PHASE_SEARCH_ROM,
+    PHASE_FUNCTION_COMMAND,
+    PHASE_WRITE_SCRATCHPAD,
+    PHASE_TRANSMIT,
+    PHASE_CONVERSION,
+} phase_t;
+
+typedef struct
+{
+    uint8_t rom[ROM_SIZE];
+    uint8_t scratchpad[SCRATCHPAD_SIZE];
+    int16_t temperature;
+} sensor_t;
+
+static sensor_t sensors[WIRE_HOST_MAX_SENSORS];
+static uint8_t sensors_count = 1U;
+static bool is_initialized;
+
+static phase_t phase;
+static uint8_t selected;
+static uint8_t rx_data[ROM_SIZE];
+static uint8_t rx_bits;
+static const uint8_t *tx_data;
+static uint8_t tx_bits;
+static uint8_t tx_size_bits;
+static uint8_t search_bit;
+static uint8_t search_step;
+static uint32_t conversion_end;
+
+static uint8_t crc8(const uint8_t *data, uint8_t size)
+{
+    uint8_t crc = 0U;
+
+    for(uint8_t i = 0U; i < size; i++)
+    {
+        uint8_t byte = data[i];
+
+        for(uint8_t j = 0U; j < 8U; j++)
+        {
+            const uint8_t mix = (crc ^ byte) & 0x01U;
+            crc >>= 1U;
+
+            if(mix != 0U)
+            {
+                crc ^= 0x8CU;
+            }
+
+            byte >>= 1U;
+        }
+    }
+
+    return crc;
+}
+
+static bool get_bit(const uint8_t *data, uint8_t bit)
+{
+    return ((data[bit / 8U] >> (bit % 8U)) & 0x01U) != 0U;
+}
+
+static uint8_t get_resolution(const sensor_t *sensor)
+{
+    return (sensor->scratchpad[SP_CONFIG] >> CONFIG_RESOLUTION_SHIFT) & CONFIG_RESOLUTION_MASK;
+}
+
+static void update_crc(sensor_t *sensor)
+{
+    sensor->scratchpad[SP_CRC] = crc8(sensor->scratchpad, SP_CRC);
+}
+
+static void initialize(void)
+{
+    if(is_initialized)
+    {
+        return;
+    }
+
+    for(uint8_t i = 0U; i < WIRE_HOST_MAX_SENSORS; i++)
+    {
+        sensor_t *sensor = &sensors[i];
+
+        memset(sensor->rom, 0, sizeof(sensor->rom));
+        sensor->rom[0] = FAMILY_DS18B20;
+        sensor->rom[1] = (uint8_t)(0xA0U + i);
+        sensor->rom[2] = (uint8_t)(0x5AU ^ i);
+        sensor->rom[ROM_SIZE - 1U] = crc8(sensor->rom, ROM_SIZE - 1U);
+
+        sensor->scratchpad[SP_TEMP_LSB] = (uint8_t)(POWER_ON_TEMPERATURE & 0xFF);
+        sensor->scratchpad[SP_TEMP_MSB] = (uint8_t)(POWER_ON_TEMPERATURE >> 8U);
+        sensor->scratchpad[SP_TH] = 0x4BU;
+        sensor->scratchpad[SP_TL] = 0x46U;
+        sensor->scratchpad[SP_CONFIG] = 0x7FU;
+        sensor->scratchpad[5] = 0xFFU;
+        sensor->scratchpad[6] = 0x0CU;
+        sensor->scratchpad[7] = 0x10U;
+        update_crc(sensor);
+
+        /* 21.5 degree indoor, 5 degree for the rest */
+        sensor->temperature = (i == 0U) ? 344 : 80;
+    }
+
+    is_initialized = true;
+}
+
+static uint8_t get_first_selected(void)
+{
+    for(uint8_t i = 0U; i < sensors_count; i++)
+    {
+        if((selected & (1U << i)) != 0U)
+        {
+            return i;
+        }
+    }
+
+    return WIRE_HOST_MAX_SENSORS;
+}
+
+static void transmit(const uint8_t *data, uint8_t size)
+{
+    tx_data = data;
+    tx_bits = 0U;
+    tx_size_bits = (uint8_t)(size * 8U);
+    phase = PHASE_TRANSMIT;
+}
+
+static void start_conversion(void)
+{
+    uint8_t slowest = 0U;
+
+    for(uint8_t i = 0U; i < sensors_count; i++)
+    {
+        if((selected & (1U << i)) == 0U)
+        {
+            continue;
+        }
+
+        sensor_t *sensor = &sensors[i];
+        const uint8_t resolution = get_resolution(sensor);
+        /* undefined low bits are read as zeros */
+        const uint16_t mask = (uint16_t)(0xFFFFU << (3U - resolution));
+        const uint16_t raw = (uint16_t)sensor->temperature & mask;
+
+        sensor->scratchpad[SP_TEMP_LSB] = (uint8_t)(raw & 0xFFU);
+        sensor->scratchpad[SP_TEMP_MSB] = (uint8_t)(raw >> 8U);
+        update_crc(sensor);
+
+        if(resolution > slowest)
+        {
+            slowest = resolution;
+        }
+    }
+
+    conversion_end = HOST_get_time_ms() + (CONVERSION_TIME_9BIT_MS << slowest);
+    phase = PHASE_CONVERSION;
+}
+
+static void handle_rom_command(uint8_t command)
+{
+    switch(command)
+    {
+        case CMD_SEARCH_ROM:
+        case CMD_ALARM_SEARCH:
+            search_bit = 0U;
+            search_step = 0U;
+            phase = PHASE_SEARCH_ROM;
+            break;
+        case CMD_READ_ROM:
+            {
+                const uint8_t sensor = get_first_selected();
+
+                if(sensor < WIRE_HOST_MAX_SENSORS)
+                {
+                    transmit(sensors[sensor].rom, ROM_SIZE);
+                }
+            }
+            break;
+        case CMD_MATCH_ROM:
+            phase = PHASE_MATCH_ROM;
+            break;
+        case CMD_SKIP_ROM:
+            phase = PHASE_FUNCTION_COMMAND;
+            break;
+        default:
+            phase = PHASE_IDLE;
+            break;
+    }
+}
+
+static void handle_function_command(uint8_t command)
+{
+    switch(command)
+    {
+        case CMD_CONVERT_T:
+            start_conversion();
+            break;
+        case CMD_READ_SCRATCHPAD:
+            {
+                const uint8_t sensor = get_first_selected();
+
+                if(sensor < WIRE_HOST_MAX_SENSORS)
+                {
+                    transmit(sensors[sensor].scratchpad, SCRATCHPAD_SIZE);
+                }
+            }
+            break;
+        case CMD_WRITE_SCRATCHPAD:
+            phase = PHASE_WRITE_SCRATCHPAD;
+            break;
+        case CMD_READ_POWER_SUPPLY:
+        case CMD_COPY_SCRATCHPAD:
+        case CMD_RECALL_EEPROM:
+        default:
+            phase = PHASE_IDLE;
+            break;
+    }
+}
+
+static void handle_match_rom(void)
+{
+    for(uint8_t i = 0U; i < sensors_count; i++)
+    {
+        if(memcmp(sensors[i].rom, rx_data, ROM_SIZE) != 0)
+        {
+            selected &= (uint8_t)~(1U << i);
+        }
+    }
+
+    phase = PHASE_FUNCTION_COMMAND;
+}
+
+static void handle_write_scratchpad(void)
+{
+    for(uint8_t i = 0U; i < sensors_count; i++)
+    {
+        if((selected & (1U << i)) != 0U)
+        {
+            sensors[i].scratchpad[SP_TH] = rx_data[0];
+            sensors[i].scratchpad[SP_TL] = rx_data[1];
+            sensors[i].scratchpad[SP_CONFIG] =
+                (uint8_t)(rx_data[2] | CONFIG_RESERVED_BITS) & 0x7FU;
+            update_crc(&sensors[i]);
+        }
+    }
+
+    phase = PHASE_IDLE;
+}
+
+static void receive_bit(bool bit)
+{
+    if(rx_bits == 0U)
+    {
+        memset(rx_data, 0, sizeof(rx_data));
+    }
+
+    if(bit)
+    {
+        rx_data[rx_bits / 8U] |= (uint8_t)(1U << (rx_bits % 8U));
+    }
+
+    rx_bits++;
+}
+
+static void search_direction(bool bit)
+{
+    for(uint8_t i = 0U; i < sensors_count; i++)
+    {
+        if(get_bit(sensors[i].rom, search_bit) != bit)
+        {
+            selected &= (uint8_t)~(1U << i);
+        }
+    }
+
+    search_bit++;
+    search_step = 0U;
+
+    if(search_bit == ROM_BITS)
+    {
+        phase = PHASE_FUNCTION_COMMAND;
+    }
+}
+
+static bool search_answer(void)
+{
+    const bool is_complement = (search_step == 1U);
+    bool line = true;
+
+    /* wired AND of all selected sensors */
+    for(uint8_t i = 0U; i < sensors_count; i++)
+    {
+        if((selected & (1U << i)) != 0U)
+        {
+            const bool bit = get_bit(sensors[i].rom, search_bit);
+            line = line && (is_complement ? !bit : bit);
+        }
+    }
+
+    search_step++;
+    return line;
+}
+
+void WIRE_configure(void)
+{
+    initialize();
+    phase = PHASE_IDLE;
+}
+
+bool WIRE_reset(void)
+{
+    initialize();
+    HOST_spend_us(RESET_TIME_US);
+
+    if(sensors_count == 0U)
+    {
+        phase = PHASE_IDLE;
+        return false;
+    }
+
+    selected = (uint8_t)((1U << sensors_count) - 1U);
+    rx_bits = 0U;
+    phase = PHASE_ROM_COMMAND;
+    return true;
+}
+
+void WIRE_send_bit(bool bit)
+{
+    HOST_spend_us(SLOT_TIME_US);
+
+    switch(phase)
+    {
+        case PHASE_ROM_COMMAND:
+        case PHASE_FUNCTION_COMMAND:
+            receive_bit(bit);
+
+            if(rx_bits == 8U)
+            {
+                rx_bits = 0U;
+
+                if(phase == PHASE_ROM_COMMAND)
+                {
+                    handle_rom_command(rx_data[0]);
+                }
+                else
+                {
+                    handle_function_command(rx_data[0]);
+                }
+            }
+            break;
+        case PHASE_MATCH_ROM:
+            receive_bit(bit);
+
+            if(rx_bits == ROM_BITS)
+            {
+                rx_bits = 0U;
+                handle_match_rom();
+            }
+            break;
+        case PHASE_WRITE_SCRATCHPAD:
+            receive_bit(bit);
+
+            if(rx_bits == (WRITE_SCRATCHPAD_SIZE * 8U))
+            {
+                rx_bits = 0U;
+                handle_write_scratchpad();
+            }
+            break;
+        case PHASE_SEARCH_ROM:
+            if(search_step == 2U)
+            {
+                search_direction(bit);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+bool WIRE_read_bit(void)
+{
+    HOST_spend_us(SLOT_TIME_US);
+
+    switch(phase)
+    {
+        case PHASE_TRANSMIT:
+            {
+                const bool bit = get_bit(tx_data, tx_bits);
+                tx_bits++;
+
+                if(tx_bits == tx_size_bits)
+                {
+                    phase = PHASE_IDLE;
+                }
+
+                return bit;
+            }
+        case PHASE_SEARCH_ROM:
+            if(search_step < 2U)
+            {
+                return search_answer();
+            }
+            return true;
+        case PHASE_CONVERSION:
+            return ((int32_t)(HOST_get_time_ms() - conversion_end) >= 0);
+        default:
+            /* bus is pulled up when nobody talks */
+            return true;
+    }
+}
+
+void WIRE_send_byte(uint8_t data)
+{
+    for(uint8_t i = 0U; i < 8U; i++)
+    {
+        WIRE_send_bit(((data >> i) & 0x01U) != 0U);
+    }
+}
+
+uint8_t WIRE_read_byte(void)
+{
+    uint8_t data = 0U;
+
+    for(uint8_t i = 0U; i < 8U; i++)
+    {
+        if(WIRE_read_bit())
+        {
+            data |= (uint8_t)(1U << i);
+        }
+    }
+
+    return data;
+}
+
+void WIRE_HOST_set_sensors_count(uint8_t count)
+{
+    initialize();
+    sensors_count = (count > WIRE_HOST_MAX_SENSORS) ? WIRE_HOST_MAX_SENSORS : count;
+}
+
+void WIRE_HOST_set_temperature(uint8_t sensor, int16_t raw)
+{
+    initialize();
+
+    if(sensor < WIRE_HOST_MAX_SENSORS)
+    {
+        sensors[sensor].temperature = raw;
+    }
+}
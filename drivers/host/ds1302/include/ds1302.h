@@ -0,0 +1,74 @@
+/*!
+ * \file
+ * \brief Host stand-in of DS1302 driver header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef DS1302_H
+#define DS1302_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup ds1302
+ * \ingroup host
+ * \brief Real time clock counting on the host clock, starting from the
+ * local time of the machine or from HOST_RTC_START (seconds since 1970)
+ */
+
+/*@{*/
+
+typedef enum
+{
+    DS1302_SECONDS,
+    DS1302_MINUTES,
+    DS1302_HOURS_12H,
+    DS1302_HOURS_24H,
+    DS1302_DATE,
+    DS1302_MONTH,
+    DS1302_WEEKDAY,
+    DS1302_YEAR,
+} DS1302_type_t;
+
+typedef struct
+{
+    uint8_t year;
+    uint8_t month;
+    uint8_t date;
+    uint8_t weekday;
+    uint8_t hours;
+    uint8_t min;
+    uint8_t secs;
+    bool is_12h_mode;
+    bool is_pm;
+} DS1302_datetime_t;
+
+void DS1302_configure(void);
+void DS1302_get(DS1302_datetime_t *datetime);
+void DS1302_set(const DS1302_datetime_t *datetime);
+void DS1302_set_write_protection(bool is_enabled);
+uint8_t DS1302_get_minutes(void);
+uint8_t DS1302_get_hours(bool is_12h_mode);
+uint8_t DS1302_get_range_maximum(uint8_t type);
+uint8_t DS1302_get_range_minimum(uint8_t type);
+
+/*@}*/
+#endif /* end of DS1302_H */
@@ -0,0 +1,161 @@
+/*!
+ * \file
+ * \brief Host stand-in of DS1302 driver implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "ds1302.h"
+#include "host.h"
+#include <time.h>
+#include <stdlib.h>
+
+#define MS_PER_S                (1000U)
+#define YEAR_BASE               (2000)
+#define TM_YEAR_BASE            (1900)
+#define HOURS_12H               (12U)
+#define NOON                    (12U)
+
+typedef struct
+{
+    uint8_t min;
+    uint8_t max;
+} range_t;
+
+static const range_t ranges[] =
+{
+    [DS1302_SECONDS] =      { .min = 0U, .max = 59U },
+    [DS1302_MINUTES] =      { .min = 0U, .max = 59U },
+    [DS1302_HOURS_12H] =    { .min = 1U, .max = 12U },
+    [DS1302_HOURS_24H] =    { .min = 0U, .max = 23U },
+    [DS1302_DATE] =         { .min = 1U, .max = 31U },
+    [DS1302_MONTH] =        { .min = 1U, .max = 12U },
+    [DS1302_WEEKDAY] =      { .min = 1U, .max = 7U },
+    [DS1302_YEAR] =         { .min = 0U, .max = 99U },
+};
+
+/* calendar time, which corresponds to host time equal zero */
+static time_t base;
+static bool is_12h_format;
+static bool is_write_protected = true;
+
+static struct tm get_now(void)
+{
+    const time_t now = base + (time_t)(HOST_get_uptime_ms() / MS_PER_S);
+    struct tm calendar;
+
+    (void)gmtime_r(&now, &calendar);
+    return calendar;
+}
+
+static uint8_t to_12h(uint8_t hours)
+{
+    const uint8_t tmp = hours % HOURS_12H;
+
+    return (tmp == 0U) ? HOURS_12H : tmp;
+}
+
+void DS1302_configure(void)
+{
+    const char *start = getenv("HOST_RTC_START");
+
+    if(start != NULL)
+    {
+        /* e.g. just before the new year, for replaying rollovers */
+        base = (time_t)strtoll(start, NULL, 10);
+    }
+    else
+    {
+        const time_t now = time(NULL);
+        struct tm calendar;
+
+        /* clock keeps local time, so it is represented as if it was UTC */
+        (void)localtime_r(&now, &calendar);
+        base = timegm(&calendar);
+    }
+
+    base -= (time_t)(HOST_get_uptime_ms() / MS_PER_S);
+}
+
+void DS1302_get(DS1302_datetime_t *datetime)
+{
+    const struct tm now = get_now();
+
+    datetime->year = (uint8_t)((now.tm_year + TM_YEAR_BASE - YEAR_BASE) % 100);
+    datetime->month = (uint8_t)(now.tm_mon + 1);
+    datetime->date = (uint8_t)now.tm_mday;
+    datetime->weekday = (uint8_t)((now.tm_wday == 0) ? 7 : now.tm_wday);
+    datetime->min = (uint8_t)now.tm_min;
+    datetime->secs = (uint8_t)now.tm_sec;
+    datetime->is_12h_mode = is_12h_format;
+    datetime->is_pm = (now.tm_hour >= (int)NOON);
+    datetime->hours = is_12h_format ? to_12h((uint8_t)now.tm_hour) : (uint8_t)now.tm_hour;
+}
+
+void DS1302_set(const DS1302_datetime_t *datetime)
+{
+    if(is_write_protected)
+    {
+        return;
+    }
+
+    struct tm calendar =
+    {
+        .tm_year = (int)datetime->year + YEAR_BASE - TM_YEAR_BASE,
+        .tm_mon = (int)datetime->month - 1,
+        .tm_mday = (int)datetime->date,
+        .tm_hour = (int)datetime->hours,
+        .tm_min = (int)datetime->min,
+        .tm_sec = (int)datetime->secs,
+    };
+
+    if(datetime->is_12h_mode)
+    {
+        calendar.tm_hour = (int)(datetime->hours % HOURS_12H) + (datetime->is_pm ? (int)NOON : 0);
+    }
+
+    is_12h_format = datetime->is_12h_mode;
+    base = timegm(&calendar) - (time_t)(HOST_get_uptime_ms() / MS_PER_S);
+}
+
+void DS1302_set_write_protection(bool is_enabled)
+{
+    is_write_protected = is_enabled;
+}
+
+uint8_t DS1302_get_minutes(void)
+{
+    return (uint8_t)get_now().tm_min;
+}
+
+uint8_t DS1302_get_hours(bool is_12h_mode)
+{
+    const uint8_t hours = (uint8_t)get_now().tm_hour;
+
+    return is_12h_mode ? to_12h(hours) : hours;
+}
+
+uint8_t DS1302_get_range_maximum(uint8_t type)
+{
+    return ranges[type].max;
+}
+
+uint8_t DS1302_get_range_minimum(uint8_t type)
+{
+    return ranges[type].min;
+}
@@ -0,0 +1 @@
+GLOBAL_INCLUDE_DIR += drivers/host/gpio/include
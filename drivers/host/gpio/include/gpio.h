@@ -0,0 +1,81 @@
+/*!
+ * \file
+ * \brief Host stand-in of GPIO driver header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef GPIO_H
+#define GPIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup gpio
+ * \ingroup host
+ * \brief Pin states kept in memory, channels resolved from gpio_config
+ */
+
+/*@{*/
+
+typedef enum
+{
+    GPIO_PORTB,
+    GPIO_PORTC,
+    GPIO_PORTD,
+} GPIO_port_t;
+
+typedef enum
+{
+    GPIO_INPUT_FLOATING,
+    GPIO_INPUT_PULL_UP,
+    GPIO_OUTPUT_PUSH_PULL,
+} GPIO_mode_t;
+
+typedef struct
+{
+    GPIO_port_t port;
+    uint8_t pin;
+    GPIO_mode_t mode;
+    bool init_value;
+} GPIO_config_t;
+
+void GPIO_configure(bool is_global_pullup);
+void GPIO_write_pin(uint8_t channel, bool value);
+bool GPIO_read_pin(uint8_t channel);
+void GPIO_toggle_pin(uint8_t channel);
+
+/*!
+ * \brief Drives an input pin from outside, e.g. simulated button
+ *
+ * \param channel channel from gpio_config
+ * \param value level on the pin
+ */
+void GPIO_HOST_set_input(uint8_t channel, bool value);
+
+/*!
+ * \brief Returns level of the pin regardless of its mode
+ *
+ * \param channel channel from gpio_config
+ */
+bool GPIO_HOST_get_pin(uint8_t channel);
+
+/*@}*/
+#endif /* end of GPIO_H */
@@ -0,0 +1,101 @@
+/*!
+ * \file
+ * \brief Host stand-in of GPIO driver implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "gpio.h"
+#include "hardware.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHANNELS_COUNT  (sizeof(gpio_config)/sizeof(gpio_config[0]))
+
+static bool pins[CHANNELS_COUNT];
+
+static void check_channel(uint8_t channel)
+{
+    if(channel >= CHANNELS_COUNT)
+    {
+        fprintf(stderr, "GPIO: invalid channel %u\n", channel);
+        abort();
+    }
+}
+
+static GPIO_config_t get_config(uint8_t channel)
+{
+    GPIO_config_t config;
+
+    check_channel(channel);
+    memcpy_P(&config, &gpio_config[channel], sizeof(config));
+    return config;
+}
+
+void GPIO_configure(bool is_global_pullup)
+{
+    for(uint8_t i = 0U; i < CHANNELS_COUNT; i++)
+    {
+        const GPIO_config_t config = get_config(i);
+
+        if(config.mode == GPIO_INPUT_PULL_UP)
+        {
+            pins[i] = is_global_pullup;
+        }
+        else
+        {
+            pins[i] = config.init_value;
+        }
+    }
+}
+
+void GPIO_write_pin(uint8_t channel, bool value)
+{
+    if(get_config(channel).mode == GPIO_OUTPUT_PUSH_PULL)
+    {
+        pins[channel] = value;
+    }
+}
+
+bool GPIO_read_pin(uint8_t channel)
+{
+    check_channel(channel);
+    return pins[channel];
+}
+
+void GPIO_toggle_pin(uint8_t channel)
+{
+    if(get_config(channel).mode == GPIO_OUTPUT_PUSH_PULL)
+    {
+        pins[channel] = !pins[channel];
+    }
+}
+
+void GPIO_HOST_set_input(uint8_t channel, bool value)
+{
+    if(get_config(channel).mode != GPIO_OUTPUT_PUSH_PULL)
+    {
+        pins[channel] = value;
+    }
+}
+
+bool GPIO_HOST_get_pin(uint8_t channel)
+{
+    check_channel(channel);
+    return pins[channel];
+}
@@ -0,0 +1,66 @@
+/*!
+ * \file
+ * \brief Host replacement of avr-libc EEPROM interface
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef HOST_AVR_EEPROM_H
+#define HOST_AVR_EEPROM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup eeprom
+ * \ingroup platform
+ * \brief EEPROM emulated by a file, see HOST_EEPROM_FILE environment variable
+ *
+ * \note Variables placed with EEMEM are addressed relatively to the start of
+ * the eeprom section, exactly as the AVR linker does it
+ */
+
+/*@{*/
+
+#define E2END                   (511U)
+
+#define EEMEM                   __attribute__((section("eeprom")))
+
+#define eeprom_busy_wait()      do {} while(!eeprom_is_ready())
+
+bool eeprom_is_ready(void);
+
+uint8_t eeprom_read_byte(const uint8_t *addr);
+uint16_t eeprom_read_word(const uint16_t *addr);
+uint32_t eeprom_read_dword(const uint32_t *addr);
+void eeprom_read_block(void *dst, const void *src, size_t size);
+
+void eeprom_write_byte(uint8_t *addr, uint8_t value);
+void eeprom_write_word(uint16_t *addr, uint16_t value);
+void eeprom_write_dword(uint32_t *addr, uint32_t value);
+void eeprom_write_block(const void *src, void *dst, size_t size);
+
+void eeprom_update_byte(uint8_t *addr, uint8_t value);
+void eeprom_update_word(uint16_t *addr, uint16_t value);
+void eeprom_update_dword(uint32_t *addr, uint32_t value);
+void eeprom_update_block(const void *src, void *dst, size_t size);
+
+/*@}*/
+#endif /* end of HOST_AVR_EEPROM_H */
@@ -0,0 +1,42 @@
+/*!
+ * \file
+ * \brief Host replacement of avr-libc interrupt interface
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+/*!
+ *
+ * \addtogroup interrupt
+ * \ingroup platform
+ * \brief There is no interrupt controller on the host, handlers become
+ * ordinary functions which are called by the stand-in drivers
+ */
+
+/*@{*/
+
+#define sei()                   do {} while(0)
+#define cli()                   do {} while(0)
+
+#define ISR(vector)             void vector(void)
+
+/*@}*/
+#endif /* end of HOST_AVR_INTERRUPT_H */
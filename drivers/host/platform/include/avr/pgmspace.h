@@ -0,0 +1,57 @@
+/*!
+ * \file
+ * \brief Host replacement of avr-libc program space utilities
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+/*!
+ *
+ * \addtogroup pgmspace
+ * \ingroup platform
+ * \brief On the host the program space is ordinary memory
+ */
+
+/*@{*/
+
+#define PROGMEM
+#define PGM_P                   const char *
+#define PSTR(s)                 (s)
+
+#define pgm_read_byte(addr)     (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)     (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)    (*(const uint32_t *)(addr))
+#define pgm_read_ptr(addr)      (*(void * const *)(addr))
+
+#define memcpy_P                memcpy
+#define strlen_P                strlen
+#define strcmp_P                strcmp
+#define printf_P                printf
+#define sprintf_P               sprintf
+#define snprintf_P              snprintf
+#define vsnprintf_P             vsnprintf
+
+/*@}*/
+#endif /* end of HOST_AVR_PGMSPACE_H */
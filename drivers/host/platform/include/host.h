@@ -0,0 +1,83 @@
+/*!
+ * \file
+ * \brief Host platform services header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef HOST_H
+#define HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup host
+ * \ingroup platform
+ * \brief Clock and helpers shared by the Linux stand-ins of the drivers
+ */
+
+/*@{*/
+
+/*!
+ * \brief Returns milliseconds elapsed since the process start
+ *
+ * \note Wraps around like the millisecond counter of the firmware
+ */
+uint32_t HOST_get_time_ms(void);
+
+/*!
+ * \brief Returns milliseconds elapsed since the process start, never wraps
+ */
+uint64_t HOST_get_uptime_ms(void);
+
+/*!
+ * \brief Returns microseconds elapsed since the process start, never wraps
+ */
+uint64_t HOST_get_uptime_us(void);
+
+/*!
+ * \brief Tells whether the time is simulated
+ *
+ * \note Simulation is enabled by HOST_SIMULATION_TIME environment variable,
+ * which holds number of seconds to be simulated, 0 means forever. Simulated
+ * time advances only when the firmware waits, so hours of operation take
+ * seconds of the host time.
+ */
+bool HOST_is_simulation(void);
+
+/*!
+ * \brief Busy time spent by the firmware, e.g. in _delay_us()
+ *
+ * \param us microseconds to spend
+ */
+void HOST_spend_us(uint32_t us);
+
+/*!
+ * \brief Releases the CPU to the operating system when nothing is due
+ *
+ * \param ms milliseconds until the earliest due work
+ *
+ * \note On the wall clock it sleeps at most one millisecond, so the timer
+ * callbacks keep their pace. In simulation the time jumps by whole \p ms.
+ */
+void HOST_idle(uint32_t ms);
+
+/*@}*/
+#endif /* end of HOST_H */
@@ -0,0 +1,45 @@
+/*!
+ * \file
+ * \brief Host replacement of avr-libc atomic blocks
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef HOST_UTIL_ATOMIC_H
+#define HOST_UTIL_ATOMIC_H
+
+/*!
+ *
+ * \addtogroup atomic
+ * \ingroup platform
+ * \brief Timer callbacks are not preemptive on the host, so blocks are
+ * atomic by nature
+ */
+
+/*@{*/
+
+#define ATOMIC_RESTORESTATE
+#define ATOMIC_FORCEON
+#define NONATOMIC_RESTORESTATE
+#define NONATOMIC_FORCEOFF
+
+#define ATOMIC_BLOCK(type)      for(int atomic_once__ = 1; atomic_once__ != 0; atomic_once__ = 0)
+#define NONATOMIC_BLOCK(type)   for(int atomic_once__ = 1; atomic_once__ != 0; atomic_once__ = 0)
+
+/*@}*/
+#endif /* end of HOST_UTIL_ATOMIC_H */
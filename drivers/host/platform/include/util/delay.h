@@ -0,0 +1,39 @@
+/*!
+ * \file
+ * \brief Host replacement of avr-libc busy wait delays
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef HOST_UTIL_DELAY_H
+#define HOST_UTIL_DELAY_H
+
+/*!
+ *
+ * \addtogroup delay
+ * \ingroup platform
+ * \brief Delays are accounted to the host clock instead of burning cycles
+ */
+
+/*@{*/
+
+void _delay_ms(double ms);
+void _delay_us(double us);
+
+/*@}*/
+#endif /* end of HOST_UTIL_DELAY_H */
@@ -0,0 +1,207 @@
+/*!
+ * \file
+ * \brief Host replacement of avr-libc EEPROM interface
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "avr/eeprom.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EEPROM_SIZE             (E2END + 1U)
+#define EEPROM_ERASED_VALUE     (0xFFU)
+#define EEPROM_DEFAULT_FILE     "eeprom.bin"
+
+/* provided by the linker as soon as any EEMEM variable exists */
+extern char __start_eeprom[] __attribute__((weak));
+
+static uint8_t memory[EEPROM_SIZE];
+static bool is_loaded;
+
+static const char *get_file_name(void)
+{
+    const char *name = getenv("HOST_EEPROM_FILE");
+
+    return (name != NULL) ? name : EEPROM_DEFAULT_FILE;
+}
+
+static void load(void)
+{
+    if(is_loaded)
+    {
+        return;
+    }
+
+    memset(memory, EEPROM_ERASED_VALUE, sizeof(memory));
+
+    FILE *file = fopen(get_file_name(), "rb");
+
+    if(file != NULL)
+    {
+        (void)fread(memory, 1U, sizeof(memory), file);
+        (void)fclose(file);
+    }
+
+    is_loaded = true;
+}
+
+static void store(void)
+{
+    FILE *file = fopen(get_file_name(), "wb");
+
+    if(file != NULL)
+    {
+        (void)fwrite(memory, 1U, sizeof(memory), file);
+        (void)fclose(file);
+    }
+}
+
+static size_t get_offset(const void *addr)
+{
+    const uintptr_t address = (uintptr_t)addr;
+
+    if(address < EEPROM_SIZE)
+    {
+        /* plain EEPROM address, not an EEMEM variable */
+        return (size_t)address;
+    }
+
+    if((__start_eeprom == NULL) || (address < (uintptr_t)__start_eeprom))
+    {
+        fprintf(stderr, "EEPROM: invalid address %p\n", addr);
+        abort();
+    }
+
+    const size_t offset = (size_t)(address - (uintptr_t)__start_eeprom);
+
+    if(offset >= EEPROM_SIZE)
+    {
+        fprintf(stderr, "EEPROM: address %p out of range\n", addr);
+        abort();
+    }
+
+    return offset;
+}
+
+bool eeprom_is_ready(void)
+{
+    return true;
+}
+
+void eeprom_read_block(void *dst, const void *src, size_t size)
+{
+    load();
+
+    const size_t offset = get_offset(src);
+
+    if((offset + size) > EEPROM_SIZE)
+    {
+        fprintf(stderr, "EEPROM: read of %zu bytes out of range\n", size);
+        abort();
+    }
+
+    memcpy(dst, &memory[offset], size);
+}
+
+void eeprom_write_block(const void *src, void *dst, size_t size)
+{
+    load();
+
+    const size_t offset = get_offset(dst);
+
+    if((offset + size) > EEPROM_SIZE)
+    {
+        fprintf(stderr, "EEPROM: write of %zu bytes out of range\n", size);
+        abort();
+    }
+
+    memcpy(&memory[offset], src, size);
+    store();
+}
+
+void eeprom_update_block(const void *src, void *dst, size_t size)
+{
+    load();
+
+    const size_t offset = get_offset(dst);
+
+    if((offset + size) > EEPROM_SIZE)
+    {
+        fprintf(stderr, "EEPROM: update of %zu bytes out of range\n", size);
+        abort();
+    }
+
+    if(memcmp(&memory[offset], src, size) != 0)
+    {
+        memcpy(&memory[offset], src, size);
+        store();
+    }
+}
+
+uint8_t eeprom_read_byte(const uint8_t *addr)
+{
+    uint8_t value;
+    eeprom_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+uint16_t eeprom_read_word(const uint16_t *addr)
+{
+    uint16_t value;
+    eeprom_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+uint32_t eeprom_read_dword(const uint32_t *addr)
+{
+    uint32_t value;
+    eeprom_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+void eeprom_write_byte(uint8_t *addr, uint8_t value)
+{
+    eeprom_write_block(&value, addr, sizeof(value));
+}
+
+void eeprom_write_word(uint16_t *addr, uint16_t value)
+{
+    eeprom_write_block(&value, addr, sizeof(value));
+}
+
+void eeprom_write_dword(uint32_t *addr, uint32_t value)
+{
+    eeprom_write_block(&value, addr, sizeof(value));
+}
+
+void eeprom_update_byte(uint8_t *addr, uint8_t value)
+{
+    eeprom_update_block(&value, addr, sizeof(value));
+}
+
+void eeprom_update_word(uint16_t *addr, uint16_t value)
+{
+    eeprom_update_block(&value, addr, sizeof(value));
+}
+
+void eeprom_update_dword(uint32_t *addr, uint32_t value)
+{
+    eeprom_update_block(&value, addr, sizeof(value));
+}
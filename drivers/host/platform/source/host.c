@@ -0,0 +1,162 @@
+/*!
+ * \file
+ * \brief Host platform services implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "host.h"
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#define NS_PER_US               (1000UL)
+#define NS_PER_MS               (1000000UL)
+#define MS_PER_S                (1000UL)
+#define US_PER_S                (1000000UL)
+#define US_PER_MS               (1000UL)
+
+static struct timespec start;
+static bool is_started;
+static bool is_simulation;
+static uint64_t simulation_us;
+static uint64_t simulation_end_us;
+
+static uint64_t get_wall_time_us(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    const int64_t ns = ((int64_t)(now.tv_sec - start.tv_sec) * (int64_t)(US_PER_S * NS_PER_US)) +
+        (int64_t)(now.tv_nsec - start.tv_nsec);
+
+    return (uint64_t)ns / NS_PER_US;
+}
+
+static void report(void)
+{
+    const uint64_t wall_us = get_wall_time_us();
+    const uint64_t ticks = simulation_us / US_PER_MS;
+    const double wall_s = (double)wall_us / (double)US_PER_S;
+
+    fprintf(stderr, "SIM: %" PRIu64 " ticks (%" PRIu64 " s) simulated in %.3f s, %.0f ticks/s\n",
+            ticks, ticks / MS_PER_S, wall_s, (wall_s > 0.0) ? ((double)ticks / wall_s) : 0.0);
+}
+
+static void initialize(void)
+{
+    if(is_started)
+    {
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    is_started = true;
+
+    const char *duration = getenv("HOST_SIMULATION_TIME");
+
+    if(duration != NULL)
+    {
+        is_simulation = true;
+        simulation_end_us = (uint64_t)strtoull(duration, NULL, 10) * US_PER_S;
+        (void)atexit(report);
+    }
+}
+
+static void sleep_us(uint32_t us)
+{
+    struct timespec request =
+    {
+        .tv_sec = (time_t)(us / US_PER_S),
+        .tv_nsec = (long)((us % US_PER_S) * NS_PER_US),
+    };
+
+    while(nanosleep(&request, &request) != 0)
+    {
+        /* interrupted by a signal, sleep the rest of time */
+    }
+}
+
+static void simulate_us(uint64_t us)
+{
+    simulation_us += us;
+
+    if((simulation_end_us != 0U) && (simulation_us >= simulation_end_us))
+    {
+        exit(EXIT_SUCCESS);
+    }
+}
+
+uint64_t HOST_get_uptime_us(void)
+{
+    initialize();
+
+    if(is_simulation)
+    {
+        return simulation_us;
+    }
+
+    return get_wall_time_us();
+}
+
+uint64_t HOST_get_uptime_ms(void)
+{
+    return HOST_get_uptime_us() / US_PER_MS;
+}
+
+uint32_t HOST_get_time_ms(void)
+{
+    return (uint32_t)HOST_get_uptime_ms();
+}
+
+bool HOST_is_simulation(void)
+{
+    initialize();
+    return is_simulation;
+}
+
+void HOST_spend_us(uint32_t us)
+{
+    initialize();
+
+    if(is_simulation)
+    {
+        simulate_us(us);
+    }
+    else
+    {
+        sleep_us(us);
+    }
+}
+
+void HOST_idle(uint32_t ms)
+{
+    initialize();
+
+    if(is_simulation)
+    {
+        /* up to the beginning of the requested millisecond */
+        simulate_us(((uint64_t)ms * US_PER_MS) - (simulation_us % US_PER_MS));
+    }
+    else
+    {
+        sleep_us(US_PER_MS);
+    }
+}
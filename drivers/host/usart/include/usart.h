@@ -0,0 +1,97 @@
+/*!
+ * \file
+ * \brief Host stand-in of USART driver header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef USART_H
+#define USART_H
+
+#include <stdint.h>
+
+/*!
+ *
+ * \addtogroup usart
+ * \ingroup host
+ * \brief Transmitted bytes go to stdout, received bytes come from stdin
+ */
+
+/*@{*/
+
+typedef enum
+{
+    USART_9600_BAUDRATE,
+    USART_19200_BAUDRATE,
+    USART_38400_BAUDRATE,
+    USART_57600_BAUDRATE,
+    USART_115200_BAUDRATE,
+} USART_baudrate_t;
+
+typedef enum
+{
+    USART_5_DATA_BITS,
+    USART_6_DATA_BITS,
+    USART_7_DATA_BITS,
+    USART_8_DATA_BITS,
+} USART_databits_t;
+
+typedef enum
+{
+    USART_NO_PARITY,
+    USART_EVEN_PARITY,
+    USART_ODD_PARITY,
+} USART_parity_t;
+
+typedef enum
+{
+    USART_1_STOP_BITS,
+    USART_2_STOP_BITS,
+} USART_stopbits_t;
+
+typedef struct
+{
+    USART_baudrate_t baudrate;
+    USART_databits_t databits;
+    USART_parity_t parity;
+    USART_stopbits_t stopbits;
+} USART_config_t;
+
+void USART_configure(const USART_config_t *config);
+
+/*!
+ * \brief Sends single byte, host only, stands in for a write of the UDR
+ * register
+ *
+ * \param data byte to be sent
+ */
+void HOST_usart_send(uint8_t data);
+
+/*!
+ * \brief Receives single byte if there is any, host only, stands in for
+ * a read of the UDR register after RXC is set
+ *
+ * \param data storage for received byte
+ *
+ * \retval 0 byte received
+ * \retval -1 nothing to receive
+ */
+int8_t HOST_usart_receive(uint8_t *data);
+
+/*@}*/
+#endif /* end of USART_H */
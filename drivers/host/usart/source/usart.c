@@ -0,0 +1,58 @@
+/*!
+ * \file
+ * \brief Host stand-in of USART driver implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "usart.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+void USART_configure(const USART_config_t *config)
+{
+    (void)config;
+
+    const int flags = fcntl(STDIN_FILENO, F_GETFL);
+
+    if(flags != -1)
+    {
+        (void)fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
+    }
+}
+
+void HOST_usart_send(uint8_t data)
+{
+    (void)putchar(data);
+
+    if(data == (uint8_t)'\n')
+    {
+        (void)fflush(stdout);
+    }
+}
+
+int8_t HOST_usart_receive(uint8_t *data)
+{
+    if(read(STDIN_FILENO, data, 1U) == 1)
+    {
+        return 0;
+    }
+
+    return -1;
+}
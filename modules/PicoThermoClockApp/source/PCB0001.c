@@ -25,30 +25,30 @@
 
 const GPIO_config_t gpio_config[18] PROGMEM =
 {
-    [GPIO_CHANNEL_COLON] =          { .port = GPIO_PORTB, .pin = 0U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_DISPLAY1] =       { .port = GPIO_PORTB, .pin = 1U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_DISPLAY2] =       { .port = GPIO_PORTB, .pin = 2U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_DISPLAY3] =       { .port = GPIO_PORTB, .pin = 3U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_DISPLAY0] =       { .port = GPIO_PORTB, .pin = 4U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_SEGMENTG] =       { .port = GPIO_PORTB, .pin = 5U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_SEGMENTC] =       { .port = GPIO_PORTC, .pin = 0U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_SEGMENTD] =       { .port = GPIO_PORTC, .pin = 1U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_SEGMENTE] =       { .port = GPIO_PORTC, .pin = 2U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_SEGMENTA] =       { .port = GPIO_PORTC, .pin = 3U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_SEGMENTF] =       { .port = GPIO_PORTC, .pin = 4U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_SEGMENTB] =       { .port = GPIO_PORTC, .pin = 5U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_INPUT_PLUS] =     { .port = GPIO_PORTD, .pin = 2U, .mode = GPIO_INPUT_FLOATING,   .init_value = false },
-    [GPIO_CHANNEL_INPUT_MINUS] =    { .port = GPIO_PORTD, .pin = 3U, .mode = GPIO_INPUT_FLOATING,   .init_value = false },
-    [GPIO_CHANNEL_1WIRE]        =   { .port = GPIO_PORTD, .pin = 4U, .mode = GPIO_INPUT_FLOATING,   .init_value = false },
-    [GPIO_CHANNEL_RTC_CLK]      =   { .port = GPIO_PORTD, .pin = 5U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_RTC_IO]       =   { .port = GPIO_PORTD, .pin = 6U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
-    [GPIO_CHANNEL_RTC_CE]       =   { .port = GPIO_PORTD, .pin = 7U, .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_COLON] =          { .port = COLON_PORT,       .pin = COLON_PIN,       .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_DISPLAY1] =       { .port = DISPLAY1_PORT,    .pin = DISPLAY1_PIN,    .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_DISPLAY2] =       { .port = DISPLAY2_PORT,    .pin = DISPLAY2_PIN,    .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_DISPLAY3] =       { .port = DISPLAY3_PORT,    .pin = DISPLAY3_PIN,    .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_DISPLAY0] =       { .port = DISPLAY0_PORT,    .pin = DISPLAY0_PIN,    .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_SEGMENTG] =       { .port = SEGMENT_G_PORT,   .pin = SEGMENT_G_PIN,   .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_SEGMENTC] =       { .port = SEGMENT_C_PORT,   .pin = SEGMENT_C_PIN,   .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_SEGMENTD] =       { .port = SEGMENT_D_PORT,   .pin = SEGMENT_D_PIN,   .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_SEGMENTE] =       { .port = SEGMENT_E_PORT,   .pin = SEGMENT_E_PIN,   .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_SEGMENTA] =       { .port = SEGMENT_A_PORT,   .pin = SEGMENT_A_PIN,   .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_SEGMENTF] =       { .port = SEGMENT_F_PORT,   .pin = SEGMENT_F_PIN,   .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_SEGMENTB] =       { .port = SEGMENT_B_PORT,   .pin = SEGMENT_B_PIN,   .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_INPUT_PLUS] =     { .port = INPUT_PLUS_PORT,  .pin = INPUT_PLUS_PIN,  .mode = GPIO_INPUT_FLOATING,   .init_value = false },
+    [GPIO_CHANNEL_INPUT_MINUS] =    { .port = INPUT_MINUS_PORT, .pin = INPUT_MINUS_PIN, .mode = GPIO_INPUT_FLOATING,   .init_value = false },
+    [GPIO_CHANNEL_1WIRE]        =   { .port = GPIO_PORTD,       .pin = 4U,              .mode = GPIO_INPUT_FLOATING,   .init_value = false },
+    [GPIO_CHANNEL_RTC_CLK]      =   { .port = GPIO_PORTD,       .pin = 5U,              .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_RTC_IO]       =   { .port = GPIO_PORTD,       .pin = 6U,              .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
+    [GPIO_CHANNEL_RTC_CE]       =   { .port = GPIO_PORTD,       .pin = 7U,              .mode = GPIO_OUTPUT_PUSH_PULL, .init_value = false },
 };
 
 const SSD_MGR_config_t ssd_config PROGMEM =
 {
-    .is_segments_inverted = false,
-    .is_displays_inverted = true
+    .is_segments_inverted = SSD_SEGMENTS_INVERTED,
+    .is_displays_inverted = SSD_DISPLAYS_INVERTED
 };
 
 const uint8_t displays_config[] PROGMEM =
@@ -55,6 +55,40 @@
 #define GPIO_CHANNEL_RTC_IO         (16U)
 #define GPIO_CHANNEL_RTC_CE         (17U)
 
+/* pins of the buttons, shared by gpio_config and the button capture */
+#define INPUT_PLUS_PORT             GPIO_PORTD
+#define INPUT_PLUS_PIN              (2U)
+#define INPUT_MINUS_PORT            GPIO_PORTD
+#define INPUT_MINUS_PIN             (3U)
+
+/* pins of the displays, shared by gpio_config and the display multiplexer */
+#define COLON_PORT                  GPIO_PORTB
+#define COLON_PIN                   (0U)
+#define SEGMENT_A_PORT              GPIO_PORTC
+#define SEGMENT_A_PIN               (3U)
+#define SEGMENT_B_PORT              GPIO_PORTC
+#define SEGMENT_B_PIN               (5U)
+#define SEGMENT_C_PORT              GPIO_PORTC
+#define SEGMENT_C_PIN               (0U)
+#define SEGMENT_D_PORT              GPIO_PORTC
+#define SEGMENT_D_PIN               (1U)
+#define SEGMENT_E_PORT              GPIO_PORTC
+#define SEGMENT_E_PIN               (2U)
+#define SEGMENT_F_PORT              GPIO_PORTC
+#define SEGMENT_F_PIN               (4U)
+#define SEGMENT_G_PORT              GPIO_PORTB
+#define SEGMENT_G_PIN               (5U)
+#define DISPLAY0_PORT               GPIO_PORTB
+#define DISPLAY0_PIN                (4U)
+#define DISPLAY1_PORT               GPIO_PORTB
+#define DISPLAY1_PIN                (1U)
+#define DISPLAY2_PORT               GPIO_PORTB
+#define DISPLAY2_PIN                (2U)
+#define DISPLAY3_PORT               GPIO_PORTB
+#define DISPLAY3_PIN                (3U)
+#define SSD_SEGMENTS_INVERTED       (false)
+#define SSD_DISPLAYS_INVERTED       (true)
+
 extern const GPIO_config_t gpio_config[18] PROGMEM;
 extern const SSD_MGR_config_t ssd_config PROGMEM;
 extern const uint8_t displays_config[4] PROGMEM;
@@ -32,9 +32,26 @@
 #include "debug.h"
 #include "ds1302.h"
 #include <util/delay.h>
-#include <avr/eeprom.h>
 #include <stdbool.h>
 #include "input_mgr.h"
+#include "uptime.h"
+#include "serial.h"
+#include "trace.h"
+#include "bench.h"
+#include "console.h"
+#include "prof.h"
+#include "clock.h"
+#include "input.h"
+#include "repeat.h"
+#include "button.h"
+#include "screen.h"
+#include "mux.h"
+#include "sensor.h"
+#include "history.h"
+#include "log.h"
+#include "settings.h"
+#include "ee_queue.h"
+#include <avr/pgmspace.h>
 
 #define DISPLAY_SPLASH_VALUE        (8888u)
 
@@ -50,6 +67,9 @@
 
 #define TASK_PERIOD                 (100u)
 
+/* both presses have to come within this time to make a double press */
+#define DOUBLE_PRESS_INTERVAL       (400U)
+
 #define EPOCH_YEAR                  (70U)
 #define EPOCH_MONTH                 (1U)
 #define EPOCH_DAY                   (1U)
@@ -59,6 +79,9 @@
 #define FAHRENHEIT_DENOMINATOR      (5U)
 #define FAHRENHEIT_OFFSET           (32)
 
+#define SCALING_SHIFT               (4U)
+#define SCALING_FACTOR              (1U << SCALING_SHIFT)
+
 #define MIN_TEMPERATURE             (-200)
 #define MAX_TEMPERATURE             (200)
 
@@ -68,10 +91,27 @@
 #define POSITION_HUNDREDS           (2U)
 #define POSITION_THOUSANDS          (3U)
 
-#define HH_MULTIPLIER               (100U)
+#define DIVIDE_BY_10_MULTIPLIER     (205U)
+#define DIVIDE_BY_10_SHIFT          (11U)
+#define BCD_TENS_SHIFT              (4U)
+#define BCD_UNITS_MASK              (0x0FU)
+#define BCD_HUNDREDS_SHIFT          (8U)
+#define HUNDRED                     (100U)
+
+/* x*52429 >> 18 equals x/5 over whole uint16_t range */
+#define DIVIDE_BY_5_MULTIPLIER      (52429UL)
+#define DIVIDE_BY_5_SHIFT           (18U)
+#define TEMPERATURE_NEGATIVE        (0x8000U)
+
 
-#define TIME_SCREEN_SWITCH_TIMEOUT  (20U)
-#define TEMP_SCREEN_SWITCH_TIMEOUT  (5U)
+#define STATS_LABEL                 (0U)
+#define STATS_MIN                   (1U)
+#define STATS_MAX                   (2U)
+#define STATS_ITEMS                 (4U)    /* the mean comes last */
+
+/* entry actions of the screens, bits of the blinking displays and the colon */
+#define ENTRY_BLINK(start, end)     ((uint8_t)((2U << (end)) - (1U << (start))))
+#define ENTRY_COLON                 (0x80U)
 
 typedef enum
 {
@@ -79,12 +119,14 @@ typedef enum
     SPLASH_SCREEN_ON,
     SPLASH_SCREEN_WAIT,
     SET_TEMP_MODE_SCREEN,
+    SET_BRIGHTNESS_SCREEN,
     SET_TIME_MODE_SCREEN,
     SET_AM_PM_SCREEN,
     SET_HOURS_SCREEN,
     SET_MINUTES_SCREEN,
     TIME_SCREEN,
     TEMP_SCREEN,
+    STATS_SCREEN,
 } APP_state_t;
 
 typedef enum
@@ -97,17 +139,58 @@ typedef enum
     DOUBLE_PRESS,
 } APP_event_t;
 
-static uint32_t tick;
+static uint32_t deadline;
 static APP_state_t state;
 static APP_state_t old_state;
-static INPUT_MGR_event_t new_input;
 static INPUT_MGR_event_t old_input;
-static SSD_MGR_displays_t *app_displays;
-static uint8_t app_displays_size;
+static uint32_t old_input_timestamp;
 static uint8_t timer5s;
+static bool is_blinking_paused;
+static uint8_t shown_seconds;
+static uint8_t shown_window;
+static uint8_t shown_item;
 static DS1302_datetime_t datetime;
-static uint8_t EEMEM is_fahrenheit_eeprom = false;
-static bool is_fahrenheit;
+static SETTINGS_data_t settings;
+
+/* hours step one by one, minutes speed up to five at once */
+static const REPEAT_config_t hours_repeat PROGMEM =
+{
+    .initial_delay = 500U,
+    .start_interval = 250U,
+    .min_interval = 150U,
+    .acceleration = 25U,
+    .step = 1U,
+    .fast_step = 1U,
+};
+
+static const REPEAT_config_t minutes_repeat PROGMEM =
+{
+    .initial_delay = 500U,
+    .start_interval = 250U,
+    .min_interval = 150U,
+    .acceleration = 25U,
+    .step = 1U,
+    .fast_step = 5U,
+};
+
+/* hours of the windows as BCD: 1h, 24h, 168h */
+static const uint16_t window_labels[HISTORY_WINDOWS] PROGMEM = { 0x001U, 0x024U, 0x168U };
+
+static const uint8_t entry_actions[] PROGMEM =
+{
+    [IDLE] = 0U,
+    [SPLASH_SCREEN_ON] = ENTRY_COLON,
+    [SPLASH_SCREEN_WAIT] = ENTRY_COLON,
+    [SET_TEMP_MODE_SCREEN] = ENTRY_BLINK(LEFT_DISP1_IDX, LEFT_DISP3_IDX),
+    [SET_BRIGHTNESS_SCREEN] = ENTRY_BLINK(LEFT_DISP1_IDX, LEFT_DISP1_IDX),
+    [SET_TIME_MODE_SCREEN] = ENTRY_BLINK(LEFT_DISP1_IDX, LEFT_DISP3_IDX),
+    [SET_AM_PM_SCREEN] = ENTRY_BLINK(LEFT_DISP1_IDX, LEFT_DISP3_IDX),
+    [SET_HOURS_SCREEN] = ENTRY_BLINK(LEFT_DISP3_IDX, LEFT_DISP4_IDX),
+    [SET_MINUTES_SCREEN] = ENTRY_BLINK(LEFT_DISP1_IDX, LEFT_DISP2_IDX),
+    [TIME_SCREEN] = 0U,
+    [TEMP_SCREEN] = 0U,
+    [STATS_SCREEN] = 0U,
+};
 
 static const DS1302_datetime_t default_datetime =
 {
@@ -152,6 +235,55 @@ static uint8_t get_digit(uint16_t value, uint8_t position)
     }
 }
 
+/* value*205/2048 equals value/10 over whole uint8_t range, so no division */
+static inline uint8_t to_bcd(uint8_t value)
+{
+    const uint8_t tens =
+        (uint8_t)(((uint16_t)value * DIVIDE_BY_10_MULTIPLIER) >> DIVIDE_BY_10_SHIFT);
+
+    return (uint8_t)((tens << BCD_TENS_SHIFT) | (uint8_t)(value - (tens * DECIMAL_BASE)));
+}
+
+/*
+ * Rounded whole degrees as BCD digits (hundreds in bits 8..11) and
+ * TEMPERATURE_NEGATIVE flag. Gives the same result as 9/5 scaling, rounding
+ * and /16 with signed divisions, but works on the magnitude, so /5 is
+ * a multiply-shift and /16 is a shift
+ */
+static uint16_t get_temperature_frame(int16_t temperature)
+{
+    int16_t converted = temperature;
+
+    if(settings.is_fahrenheit)
+    {
+        converted = (FAHRENHEIT_NUMERATOR*temperature) +
+            (SCALING_FACTOR*FAHRENHEIT_DENOMINATOR*FAHRENHEIT_OFFSET);
+    }
+
+    const bool is_scaled_negative = (converted < 0);
+    uint16_t magnitude = is_scaled_negative ? (uint16_t)-converted : (uint16_t)converted;
+
+    if(settings.is_fahrenheit)
+    {
+        magnitude =
+            (uint16_t)(((uint32_t)magnitude * DIVIDE_BY_5_MULTIPLIER) >> DIVIDE_BY_5_SHIFT);
+    }
+
+    const bool is_negative = is_scaled_negative && (magnitude != 0U);
+    uint8_t hundreds = 0U;
+
+    magnitude = (magnitude + (SCALING_FACTOR/2U)) >> SCALING_SHIFT;
+
+    while(magnitude >= HUNDRED)
+    {
+        magnitude -= HUNDRED;
+        hundreds++;
+    }
+
+    return ((uint16_t)hundreds << BCD_HUNDREDS_SHIFT) | to_bcd((uint8_t)magnitude) |
+        (is_negative ? TEMPERATURE_NEGATIVE : 0U);
+}
+
 static void set_input_to_defaults(INPUT_MGR_event_t *event)
 {
     event->id = UINT8_MAX;
@@ -160,174 +292,246 @@ static void set_input_to_defaults(INPUT_MGR_event_t *event)
 
 static void callback(void)
 {
-    if(tick != 0U)
-    {
-        tick--;
-    }
+    UPTIME_tick();
+    CLOCK_tick();
+    BUTTON_tick();
+    MUX_tick();
+    SERIAL_tick();
+    EE_QUEUE_tick();
+}
+
+static void set_delay(uint16_t delay)
+{
+    deadline = UPTIME_get_ms() + delay;
+}
+
+static bool is_delay_over(void)
+{
+    return ((int32_t)(UPTIME_get_ms() - deadline) >= 0);
 }
 
 static void set_to_display(uint16_t value)
 {
-    for(uint8_t i = 0u; i < app_displays_size; i++)
+    for(uint8_t i = 0u; i < SCREEN_DIGITS; i++)
     {
         uint8_t digit = get_digit(value, i);
-        SSD_MGR_display_set(&app_displays[i], digit);
+        SCREEN_set(i, digit);
     }
 }
 
-static uint8_t increment_over_range(uint8_t type, uint8_t value)
+static void set_time_to_display(uint8_t hours, uint8_t minutes)
+{
+    const uint8_t hh = to_bcd(hours);
+    const uint8_t mm = to_bcd(minutes);
+
+    SCREEN_set(LEFT_DISP1_IDX, mm & BCD_UNITS_MASK);
+    SCREEN_set(LEFT_DISP2_IDX, mm >> BCD_TENS_SHIFT);
+    SCREEN_set(LEFT_DISP3_IDX, hh & BCD_UNITS_MASK);
+    SCREEN_set(LEFT_DISP4_IDX, hh >> BCD_TENS_SHIFT);
+}
+
+static uint8_t increment_over_range(uint8_t type, uint8_t value, uint8_t steps)
 {
     const uint8_t max = DS1302_get_range_maximum(type);
     const uint8_t min = DS1302_get_range_minimum(type);
     uint8_t tmp = value;
 
-    if(tmp == max)
-    {
-        tmp = min;
-    }
-    else
+    for(uint8_t i = 0U; i < steps; i++)
     {
-        tmp++;
+        if(tmp == max)
+        {
+            tmp = min;
+        }
+        else
+        {
+            tmp++;
+        }
     }
 
     return tmp;
 }
 
-static void set_blinking(uint8_t start, uint8_t end, bool value)
+/* digits stay lit while a held button steps the value */
+static void pause_blinking(APP_event_t event)
 {
-    for(uint8_t i = start; i <= end; i++)
+    const bool is_paused = (event == MINUS_LONG_PRESS) || (event == PLUS_LONG_PRESS);
+
+    if(is_paused != is_blinking_paused)
     {
-        SSD_MGR_display_blink(&app_displays[i], value);
+        is_blinking_paused = is_paused;
+        SCREEN_set_blinking(is_paused ? 0U :
+                (pgm_read_byte(&entry_actions[state]) & ~ENTRY_COLON));
     }
 }
 
-static uint8_t decrement_over_range(uint8_t type, uint8_t value)
+static void enter_state(APP_state_t new_state)
+{
+    const uint8_t actions = pgm_read_byte(&entry_actions[new_state]);
+
+    is_blinking_paused = false;
+    SCREEN_set_blinking(actions & ~ENTRY_COLON);
+    SCREEN_set_colon((actions & ENTRY_COLON) != 0U);
+}
+
+static uint8_t decrement_over_range(uint8_t type, uint8_t value, uint8_t steps)
 {
     const uint8_t max = DS1302_get_range_maximum(type);
     const uint8_t min = DS1302_get_range_minimum(type);
     uint8_t tmp = value;
 
-    if(tmp == min)
-    {
-        tmp = max;
-    }
-    else
+    for(uint8_t i = 0U; i < steps; i++)
     {
-        tmp--;
+        if(tmp == min)
+        {
+            tmp = max;
+        }
+        else
+        {
+            tmp--;
+        }
     }
 
     return tmp;
 }
 
 
-APP_event_t get_app_event(void)
+static APP_event_t get_app_event(const INPUT_event_t *input)
 {
     APP_event_t ret = INVALID;
+    INPUT_MGR_event_t new_input = input->event;
 
-    if(INPUT_MGR_get_event(&new_input) == 0)
-    {
-        DEBUG(DL_VERBOSE, "Ev: [%d] \n",new_input.event);
+    DEBUG(DL_VERBOSE, "Ev: [%d] \n",new_input.event);
 
-        if((old_input.event == BUTTON_SHORT_PRESSED) &&
-                (new_input.event == BUTTON_SHORT_PRESSED))
-        {
-            set_input_to_defaults(&new_input);
-            ret = DOUBLE_PRESS;
-        }
-        else if((old_input.id == INPUT_MINUS_ID) &&
-                (old_input.event == BUTTON_SHORT_PRESSED) &&
-                (new_input.id == INPUT_MINUS_ID) &&
-                (new_input.event == BUTTON_RELEASED))
-        {
-            ret = MINUS_RELEASE;
-        }
-        else if((old_input.id == INPUT_PLUS_ID) &&
-                (old_input.event == BUTTON_SHORT_PRESSED) &&
-                (new_input.id == INPUT_PLUS_ID) &&
-                (new_input.event == BUTTON_RELEASED))
-        {
-            ret = PLUS_RELEASE;
-        }
-        else
-        {
-            /* ignore rest of cases */
-        }
-
-
-        old_input = new_input;
+    if((old_input.event == BUTTON_SHORT_PRESSED) &&
+            (new_input.event == BUTTON_SHORT_PRESSED) &&
+            ((input->timestamp - old_input_timestamp) <= DOUBLE_PRESS_INTERVAL))
+    {
+        set_input_to_defaults(&new_input);
+        ret = DOUBLE_PRESS;
     }
-
-    if((new_input.id == INPUT_MINUS_ID) &&
-            (new_input.event == BUTTON_LONG_PRESSED))
+    else if((old_input.id == INPUT_MINUS_ID) &&
+            (old_input.event == BUTTON_SHORT_PRESSED) &&
+            (new_input.id == INPUT_MINUS_ID) &&
+            (new_input.event == BUTTON_RELEASED))
+    {
+        ret = MINUS_RELEASE;
+    }
+    else if((old_input.id == INPUT_PLUS_ID) &&
+            (old_input.event == BUTTON_SHORT_PRESSED) &&
+            (new_input.id == INPUT_PLUS_ID) &&
+            (new_input.event == BUTTON_RELEASED))
+    {
+        ret = PLUS_RELEASE;
+    }
+    else
     {
-        ret = MINUS_LONG_PRESS;
+        /* ignore rest of cases */
     }
 
-    if((new_input.id == INPUT_PLUS_ID) &&
-            (new_input.event == BUTTON_LONG_PRESSED))
+    if(new_input.event == BUTTON_LONG_PRESSED)
     {
-        ret = PLUS_LONG_PRESS;
+        REPEAT_start((uint16_t)input->timestamp);
     }
 
+    old_input = new_input;
+    old_input_timestamp = input->timestamp;
+
     return ret;
 }
 
+/* long press lasts until the next event of the buttons */
+static APP_event_t get_held_event(void)
+{
+    if(old_input.event == BUTTON_LONG_PRESSED)
+    {
+        if(old_input.id == INPUT_MINUS_ID)
+        {
+            return MINUS_LONG_PRESS;
+        }
+
+        if(old_input.id == INPUT_PLUS_ID)
+        {
+            return PLUS_LONG_PRESS;
+        }
+    }
+
+    return INVALID;
+}
+
 static APP_state_t handle_splash_screen_on(void)
 {
-    GPIO_write_pin(GPIO_CHANNEL_COLON, true);
     set_to_display(DISPLAY_SPLASH_VALUE);
-    tick = STATE_DELAY_5S;
+    set_delay(STATE_DELAY_5S);
     return SPLASH_SCREEN_WAIT;
 }
 
 static APP_state_t handle_splash_screen_wait(void)
 {
-    if(tick != 0)
+    if(!is_delay_over())
     {
         return SPLASH_SCREEN_WAIT;
     }
 
-    uint8_t tmp = eeprom_read_byte(&is_fahrenheit_eeprom);
+    const bool is_configured = SETTINGS_get(&settings);
 
-    DS1302_get(&datetime);
+    TRACE_get_datetime(&datetime);
+    MUX_set_brightness(settings.brightness);
 
-    if((tmp != 0U) && (tmp != 1U))
-    {
-        return SET_TEMP_MODE_SCREEN;
-    }
-
-    is_fahrenheit = (bool)tmp;
-    return TIME_SCREEN;
+    return is_configured ? TIME_SCREEN : SET_TEMP_MODE_SCREEN;
 }
 
 static APP_state_t handle_set_temp_mode_screen(APP_event_t event)
 {
     APP_state_t ret = SET_TEMP_MODE_SCREEN;
 
-    GPIO_write_pin(GPIO_CHANNEL_COLON, false);
+    switch(event)
+    {
+        case MINUS_RELEASE:
+        case PLUS_RELEASE:
+            settings.is_fahrenheit = !settings.is_fahrenheit;
+            break;
+        case DOUBLE_PRESS:
+            SETTINGS_set(&settings);
+            set_delay(STATE_DELAY_1S);
+            ret =  SET_BRIGHTNESS_SCREEN;
+            break;
+        default:
+            break;
+    }
 
-    set_blinking(LEFT_DISP1_IDX, LEFT_DISP3_IDX, true);
+    SCREEN_set(LEFT_DISP4_IDX, SSD_BLANK);
+    SCREEN_set(LEFT_DISP3_IDX, settings.is_fahrenheit ? SSD_DIGIT_3 : SSD_BLANK);
+    SCREEN_set(LEFT_DISP2_IDX, settings.is_fahrenheit ? SSD_DIGIT_2 : SSD_DIGIT_0);
+    SCREEN_set(LEFT_DISP1_IDX, settings.is_fahrenheit ? SSD_CHAR_F : SSD_CHAR_C);
+
+    return ret;
+}
+
+/* both buttons step through the levels, the dimmest one follows the full brightness */
+static APP_state_t handle_set_brightness_screen(APP_event_t event)
+{
+    APP_state_t ret = SET_BRIGHTNESS_SCREEN;
 
     switch(event)
     {
         case MINUS_RELEASE:
         case PLUS_RELEASE:
-            is_fahrenheit = !is_fahrenheit;
+            settings.brightness = (settings.brightness % MUX_BRIGHTNESS_LEVELS) + 1U;
             break;
         case DOUBLE_PRESS:
-            eeprom_write_byte(&is_fahrenheit_eeprom, (uint8_t)is_fahrenheit);
-            set_blinking(LEFT_DISP1_IDX, LEFT_DISP3_IDX, false);
-            tick = STATE_DELAY_1S;
-            ret =  SET_TIME_MODE_SCREEN;
+            SETTINGS_set(&settings);
+            set_delay(STATE_DELAY_1S);
+            ret = SET_TIME_MODE_SCREEN;
             break;
         default:
             break;
     }
 
-    SSD_MGR_display_set(&app_displays[LEFT_DISP4_IDX], SSD_BLANK);
-    SSD_MGR_display_set(&app_displays[LEFT_DISP3_IDX], is_fahrenheit ? SSD_DIGIT_3 : SSD_BLANK);
-    SSD_MGR_display_set(&app_displays[LEFT_DISP2_IDX], is_fahrenheit ? SSD_DIGIT_2 : SSD_DIGIT_0);
-    SSD_MGR_display_set(&app_displays[LEFT_DISP1_IDX], is_fahrenheit ? SSD_CHAR_F : SSD_CHAR_C);
+    MUX_set_brightness(settings.brightness);
+    SCREEN_set(LEFT_DISP4_IDX, SSD_BLANK);
+    SCREEN_set(LEFT_DISP3_IDX, SSD_BLANK);
+    SCREEN_set(LEFT_DISP2_IDX, SSD_BLANK);
+    SCREEN_set(LEFT_DISP1_IDX, settings.brightness);
 
     return ret;
 }
@@ -336,8 +540,6 @@ static APP_state_t handle_set_time_mode_screen(APP_event_t event)
 {
     APP_state_t ret = SET_TIME_MODE_SCREEN;
 
-    set_blinking(LEFT_DISP1_IDX, LEFT_DISP3_IDX, true);
-
     switch(event)
     {
         case MINUS_RELEASE:
@@ -345,20 +547,21 @@ static APP_state_t handle_set_time_mode_screen(APP_event_t event)
             datetime.is_12h_mode = !datetime.is_12h_mode;
             break;
         case DOUBLE_PRESS:
+            settings.is_12h_mode = datetime.is_12h_mode;
+            SETTINGS_set(&settings);
             ret = datetime.is_12h_mode ? SET_AM_PM_SCREEN : SET_HOURS_SCREEN;
-            set_blinking(LEFT_DISP1_IDX, LEFT_DISP3_IDX, false);
-            tick = STATE_DELAY_1S;
+            set_delay(STATE_DELAY_1S);
             break;
         default:
             break;
     }
 
-    const uint8_t format = (datetime.is_12h_mode) ? 12U : 24U;
+    const uint8_t format = (datetime.is_12h_mode) ? 0x12U : 0x24U;
 
-    SSD_MGR_display_set(&app_displays[LEFT_DISP4_IDX], SSD_BLANK);
-    SSD_MGR_display_set(&app_displays[LEFT_DISP3_IDX], get_digit(format,1U));
-    SSD_MGR_display_set(&app_displays[LEFT_DISP2_IDX], get_digit(format,0U));
-    SSD_MGR_display_set(&app_displays[LEFT_DISP1_IDX], SSD_CHAR_h);
+    SCREEN_set(LEFT_DISP4_IDX, SSD_BLANK);
+    SCREEN_set(LEFT_DISP3_IDX, format >> BCD_TENS_SHIFT);
+    SCREEN_set(LEFT_DISP2_IDX, format & BCD_UNITS_MASK);
+    SCREEN_set(LEFT_DISP1_IDX, SSD_CHAR_h);
 
     return ret;
 }
@@ -366,42 +569,34 @@ static APP_state_t handle_set_time_mode_screen(APP_event_t event)
 static APP_state_t handle_set_hours_screen(APP_event_t event)
 {
     APP_state_t ret = SET_HOURS_SCREEN;
+    const uint8_t type = (datetime.is_12h_mode) ? DS1302_HOURS_12H : DS1302_HOURS_24H;
+    uint8_t steps = 1U;
 
-    set_blinking(LEFT_DISP3_IDX, LEFT_DISP4_IDX, true);
+    pause_blinking(event);
 
     switch(event)
     {
         case MINUS_LONG_PRESS:
-            set_blinking(LEFT_DISP3_IDX, LEFT_DISP4_IDX, false);
+            steps = REPEAT_get_steps(&hours_repeat, (uint16_t)UPTIME_get_ms());
             /* fallthrough */
         case MINUS_RELEASE:
-            {
-                const uint8_t type =
-                    (datetime.is_12h_mode) ? DS1302_HOURS_12H : DS1302_HOURS_24H;
-                datetime.hours = decrement_over_range(type, datetime.hours);
-            }
+            datetime.hours = decrement_over_range(type, datetime.hours, steps);
             break;
         case PLUS_LONG_PRESS:
-            set_blinking(LEFT_DISP3_IDX, LEFT_DISP4_IDX, false);
+            steps = REPEAT_get_steps(&hours_repeat, (uint16_t)UPTIME_get_ms());
             /* fallthrough */
         case PLUS_RELEASE:
-            {
-                const uint8_t type =
-                    (datetime.is_12h_mode) ? DS1302_HOURS_12H : DS1302_HOURS_24H;
-                datetime.hours = increment_over_range(type, datetime.hours);
-            }
+            datetime.hours = increment_over_range(type, datetime.hours, steps);
             break;
         case DOUBLE_PRESS:
             ret = SET_MINUTES_SCREEN;
-            set_blinking(LEFT_DISP3_IDX, LEFT_DISP4_IDX, false);
-            tick = STATE_DELAY_1S;
+            set_delay(STATE_DELAY_1S);
             break;
         default:
             break;
     }
 
-    uint16_t const to_display = (datetime.hours*100U) + datetime.min;
-    set_to_display(to_display);
+    set_time_to_display(datetime.hours, datetime.min);
     return ret;
 }
 
@@ -409,8 +604,6 @@ static APP_state_t handle_set_am_pm_screen(APP_event_t event)
 {
     APP_state_t ret = SET_AM_PM_SCREEN;
 
-    set_blinking(LEFT_DISP1_IDX, LEFT_DISP3_IDX, true);
-
     switch(event)
     {
         case MINUS_RELEASE:
@@ -419,18 +612,16 @@ static APP_state_t handle_set_am_pm_screen(APP_event_t event)
             break;
         case DOUBLE_PRESS:
             ret = SET_HOURS_SCREEN;
-            set_blinking(LEFT_DISP1_IDX, LEFT_DISP3_IDX, false);
-            tick = STATE_DELAY_1S;
+            set_delay(STATE_DELAY_1S);
             break;
         default:
             break;
     }
 
-    SSD_MGR_display_set(&app_displays[LEFT_DISP4_IDX], SSD_BLANK);
-    SSD_MGR_display_set(&app_displays[LEFT_DISP3_IDX], SSD_BLANK);
-    SSD_MGR_display_set(&app_displays[LEFT_DISP2_IDX], SSD_BLANK);
-    SSD_MGR_display_set(&app_displays[LEFT_DISP1_IDX],
-            datetime.is_pm ? SSD_CHAR_P : SSD_CHAR_A);
+    SCREEN_set(LEFT_DISP4_IDX, SSD_BLANK);
+    SCREEN_set(LEFT_DISP3_IDX, SSD_BLANK);
+    SCREEN_set(LEFT_DISP2_IDX, SSD_BLANK);
+    SCREEN_set(LEFT_DISP1_IDX, datetime.is_pm ? SSD_CHAR_P : SSD_CHAR_A);
 
     return ret;
 }
@@ -438,37 +629,37 @@ static APP_state_t handle_set_am_pm_screen(APP_event_t event)
 static APP_state_t handle_set_minutes_screen(APP_event_t event)
 {
     APP_state_t ret = SET_MINUTES_SCREEN;
+    uint8_t steps = 1U;
 
-    set_blinking(LEFT_DISP1_IDX, LEFT_DISP2_IDX, true);
+    pause_blinking(event);
 
     switch(event)
     {
         case MINUS_LONG_PRESS:
-            set_blinking(LEFT_DISP1_IDX, LEFT_DISP2_IDX, false);
+            steps = REPEAT_get_steps(&minutes_repeat, (uint16_t)UPTIME_get_ms());
             /* fallthrough */
         case MINUS_RELEASE:
-            datetime.min = decrement_over_range(DS1302_MINUTES, datetime.min);
+            datetime.min = decrement_over_range(DS1302_MINUTES, datetime.min, steps);
             break;
         case PLUS_LONG_PRESS:
-            set_blinking(LEFT_DISP1_IDX, LEFT_DISP2_IDX, false);
+            steps = REPEAT_get_steps(&minutes_repeat, (uint16_t)UPTIME_get_ms());
             /* fallthrough */
         case PLUS_RELEASE:
-            datetime.min = increment_over_range(DS1302_MINUTES, datetime.min);
+            datetime.min = increment_over_range(DS1302_MINUTES, datetime.min, steps);
             break;
         case DOUBLE_PRESS:
             ret = TIME_SCREEN;
             DEBUG(DL_ERROR, "%d:%d:%d\n",datetime.hours, datetime.min, datetime.secs);
             DS1302_set_write_protection(false);
             DS1302_set(&datetime);
-            set_blinking(LEFT_DISP1_IDX, LEFT_DISP2_IDX, false);
-            tick = STATE_DELAY_1S;
+            CLOCK_resync();
+            set_delay(STATE_DELAY_1S);
             break;
         default:
             break;
     }
 
-    uint16_t const to_display = (datetime.hours*100U) + datetime.min;
-    set_to_display(to_display);
+    set_time_to_display(datetime.hours, datetime.min);
     return ret;
 }
 
@@ -477,28 +668,35 @@ static APP_state_t handle_time_screen(APP_event_t event)
 {
     if(event == DOUBLE_PRESS)
     {
-        GPIO_write_pin(GPIO_CHANNEL_COLON, false);
         datetime = default_datetime;
+        shown_seconds = UINT8_MAX;
         return SET_TEMP_MODE_SCREEN;
     }
 
-    if(tick != 0)
+    if(!is_delay_over())
     {
         return TIME_SCREEN;
     }
 
-    uint8_t mm = DS1302_get_minutes();
-    uint8_t hh = DS1302_get_hours(datetime.is_12h_mode);
+    CLOCK_time_t now;
+
+    CLOCK_get(&now, settings.is_12h_mode);
+    SCREEN_set_colon(now.ms < CLOCK_HALF_SECOND);
 
-    set_to_display((hh*HH_MULTIPLIER) + mm);
-    tick = STATE_DELAY_1S;
-    GPIO_toggle_pin(GPIO_CHANNEL_COLON);
+    if(now.secs == shown_seconds)
+    {
+        return TIME_SCREEN;
+    }
+
+    shown_seconds = now.secs;
+    set_time_to_display(now.hours, now.min);
     timer5s++;
 
-    if(timer5s > TIME_SCREEN_SWITCH_TIMEOUT)
+    if(timer5s > settings.time_screen_timeout)
     {
         timer5s = 0u;
-        tick = STATE_DELAY_1S;
+        set_delay(STATE_DELAY_1S);
+        shown_seconds = UINT8_MAX;
         return TEMP_SCREEN;
     }
     else
@@ -507,94 +705,141 @@ static APP_state_t handle_time_screen(APP_event_t event)
     }
 }
 
+static void show_temperature(bool is_valid, int16_t temperature, uint8_t unit)
+{
+    if(is_valid && is_temperature_in_range(temperature, SCALING_FACTOR))
+    {
+        const uint16_t frame = get_temperature_frame(temperature);
+
+        SCREEN_set(LEFT_DISP1_IDX, unit);
+        SCREEN_set(LEFT_DISP2_IDX, frame & BCD_UNITS_MASK);
+        SCREEN_set(LEFT_DISP3_IDX, (frame >> BCD_TENS_SHIFT) & BCD_UNITS_MASK);
+        SCREEN_set(LEFT_DISP4_IDX,
+                ((frame & TEMPERATURE_NEGATIVE) != 0U) ? SSD_SYMBOL_MINUS :
+                ((frame >> BCD_HUNDREDS_SHIFT) & BCD_UNITS_MASK));
+    }
+    else
+    {
+        SCREEN_set(LEFT_DISP4_IDX, SSD_BLANK);
+        SCREEN_set(LEFT_DISP3_IDX, SSD_CHAR_E);
+        SCREEN_set(LEFT_DISP2_IDX, SSD_CHAR_r);
+        SCREEN_set(LEFT_DISP1_IDX, SSD_CHAR_r);
+    }
+}
+
 static APP_state_t handle_temp_screen(APP_event_t event)
 {
     if(event == DOUBLE_PRESS)
     {
-        GPIO_write_pin(GPIO_CHANNEL_COLON, false);
         datetime = default_datetime;
         return SET_TEMP_MODE_SCREEN;
     }
 
-    if(tick != 0)
+    if(!is_delay_over())
     {
         return TEMP_SCREEN;
     }
 
     int16_t temperature;
-    const uint8_t scaling_factor = (1U << 4U);
+    const bool is_valid = SENSOR_get_temperature(&temperature);
 
-    if(WIRE_MGR_get_temperature(&temperature) &&
-            is_temperature_in_range(temperature, scaling_factor))
-    {
-        const uint8_t accuracy = scaling_factor/2U;
-        int16_t temperature_converted = temperature;
+    show_temperature(is_valid, temperature, settings.is_fahrenheit ? SSD_CHAR_F: SSD_CHAR_C);
 
-        if(is_fahrenheit)
-        {
-            const uint8_t num = FAHRENHEIT_NUMERATOR;
-            const uint8_t denom = FAHRENHEIT_DENOMINATOR;
+    set_delay(STATE_DELAY_1S);
+    timer5s++;
 
-            temperature_converted =
-                ((num*temperature) + (scaling_factor*denom*FAHRENHEIT_OFFSET))/denom;
-        }
+    if(timer5s > settings.temp_screen_timeout)
+    {
+        timer5s = 0;
+        set_delay(STATE_DELAY_1S);
+        shown_window = HISTORY_HOUR;
+        shown_item = STATS_LABEL;
+        return STATS_SCREEN;
+    }
 
-        const bool is_negative = (temperature_converted < 0);
+    return TEMP_SCREEN;
+}
+
+static void show_window_label(void)
+{
+    const uint16_t hours = pgm_read_word(&window_labels[shown_window]);
 
-        int16_t temperature_rounded = is_negative ?
-            (temperature_converted - accuracy) : (temperature_converted + accuracy);
-        int16_t temperature_renormalized = (temperature_rounded/scaling_factor);
+    SCREEN_set(LEFT_DISP1_IDX, SSD_CHAR_h);
+    SCREEN_set(LEFT_DISP2_IDX, hours & BCD_UNITS_MASK);
+    SCREEN_set(LEFT_DISP3_IDX, (hours > 0x9U) ? ((hours >> BCD_TENS_SHIFT) & BCD_UNITS_MASK) :
+            SSD_BLANK);
+    SCREEN_set(LEFT_DISP4_IDX, (hours > 0x99U) ? (hours >> BCD_HUNDREDS_SHIFT) : SSD_BLANK);
+}
 
-        GPIO_write_pin(GPIO_CHANNEL_COLON, false);
+/*
+ * Label of each window, then its minimum and maximum with the unit and its
+ * mean with A in place of the unit, a second each. Windows without data yet
+ * are skipped.
+ */
+static APP_state_t handle_stats_screen(APP_event_t event)
+{
+    if(event == DOUBLE_PRESS)
+    {
+        datetime = default_datetime;
+        return SET_TEMP_MODE_SCREEN;
+    }
 
-        uint16_t temp_abs = is_negative ?
-            -temperature_renormalized : temperature_renormalized;
+    if(!is_delay_over())
+    {
+        return STATS_SCREEN;
+    }
 
-        SSD_MGR_display_set(&app_displays[LEFT_DISP1_IDX], is_fahrenheit ? SSD_CHAR_F: SSD_CHAR_C);
-        uint8_t digit = get_digit(temp_abs, POSITION_UNITS);
-        SSD_MGR_display_set(&app_displays[LEFT_DISP2_IDX], digit);
-        digit = get_digit(temp_abs, POSITION_TENS);
-        SSD_MGR_display_set(&app_displays[LEFT_DISP3_IDX], digit);
-        digit = get_digit(temp_abs, POSITION_HUNDREDS);
-        SSD_MGR_display_set(&app_displays[LEFT_DISP4_IDX], digit);
+    HISTORY_summary_t summary;
 
-        if(is_negative)
-        {
-            SSD_MGR_display_set(&app_displays[LEFT_DISP4_IDX], SSD_SYMBOL_MINUS);
-        }
+    while((shown_window < HISTORY_WINDOWS) && !HISTORY_get(shown_window, &summary))
+    {
+        shown_window++;
     }
-    else
+
+    if(shown_window == HISTORY_WINDOWS)
     {
-        SSD_MGR_display_set(&app_displays[LEFT_DISP4_IDX], SSD_BLANK);
-        SSD_MGR_display_set(&app_displays[LEFT_DISP3_IDX], SSD_CHAR_E);
-        SSD_MGR_display_set(&app_displays[LEFT_DISP2_IDX], SSD_CHAR_r);
-        SSD_MGR_display_set(&app_displays[LEFT_DISP1_IDX], SSD_CHAR_r);
+        return TIME_SCREEN;
     }
 
+    const uint8_t unit = settings.is_fahrenheit ? SSD_CHAR_F : SSD_CHAR_C;
 
-    tick = STATE_DELAY_1S;
-    timer5s++;
+    switch(shown_item)
+    {
+        case STATS_LABEL:
+            show_window_label();
+            break;
+        case STATS_MIN:
+            show_temperature(true, summary.min, unit);
+            break;
+        case STATS_MAX:
+            show_temperature(true, summary.max, unit);
+            break;
+        default:
+            show_temperature(true, summary.mean, SSD_CHAR_A);
+            break;
+    }
 
-    if(timer5s > TEMP_SCREEN_SWITCH_TIMEOUT)
+    set_delay(STATE_DELAY_1S);
+    shown_item++;
+
+    if(shown_item == STATS_ITEMS)
     {
-        timer5s = 0;
-        tick = STATE_DELAY_1S;
-        return TIME_SCREEN;
+        shown_item = STATS_LABEL;
+        shown_window++;
     }
 
-    return TEMP_SCREEN;
+    return STATS_SCREEN;
 }
 
-static void app_main(void)
+static void handle_event(APP_event_t app_event)
 {
     if(old_state != state)
     {
         DEBUG(DL_VERBOSE, "Old [%d] -> New [%d]\n", old_state, state);
         old_state = state;
+        enter_state(state);
     }
 
-    APP_event_t app_event = get_app_event();
-
     switch(state)
     {
         case IDLE:
@@ -609,6 +854,9 @@ static void app_main(void)
         case SET_TEMP_MODE_SCREEN:
             state = handle_set_temp_mode_screen(app_event);
             break;
+        case SET_BRIGHTNESS_SCREEN:
+            state = handle_set_brightness_screen(app_event);
+            break;
         case SET_TIME_MODE_SCREEN:
             state = handle_set_time_mode_screen(app_event);
             break;
@@ -627,17 +875,163 @@ static void app_main(void)
         case TEMP_SCREEN:
             state = handle_temp_screen(app_event);
             break;
+        case STATS_SCREEN:
+            state = handle_stats_screen(app_event);
+            break;
         default:
             ASSERT(false);
     }
 }
 
+static void app_main(void)
+{
+    INPUT_event_t input;
+
+    CONSOLE_main();
+    CLOCK_main();
+    SENSOR_main();
+    HISTORY_main();
+    SETTINGS_main();
+
+    while(INPUT_get_event(&input) == 0)
+    {
+        const APP_event_t app_event = get_app_event(&input);
+
+        if(app_event != INVALID)
+        {
+            handle_event(app_event);
+        }
+    }
+
+    handle_event(get_held_event());
+    SCREEN_flush();
+}
+
+#if BENCHMARK_ENABLED
+/* arithmetic replaced by get_temperature_frame, kept for comparison */
+static int16_t convert_temperature(int16_t temperature, bool *is_negative)
+{
+    const uint8_t scaling_factor = SCALING_FACTOR;
+    const uint8_t accuracy = scaling_factor/2U;
+    int16_t temperature_converted = temperature;
+
+    if(settings.is_fahrenheit)
+    {
+        const uint8_t num = FAHRENHEIT_NUMERATOR;
+        const uint8_t denom = FAHRENHEIT_DENOMINATOR;
+
+        temperature_converted =
+            ((num*temperature) + (scaling_factor*denom*FAHRENHEIT_OFFSET))/denom;
+    }
+
+    *is_negative = (temperature_converted < 0);
+
+    int16_t temperature_rounded = *is_negative ?
+        (temperature_converted - accuracy) : (temperature_converted + accuracy);
+
+    return (temperature_rounded/scaling_factor);
+}
+
+static volatile uint16_t bench_value = 1234U;
+static volatile int16_t bench_temperature = 401;
+static volatile uint16_t bench_sink;
+
+static void bench_get_digit_units(void)
+{
+    bench_sink = get_digit(bench_value, POSITION_UNITS);
+}
+
+static void bench_get_digit_thousands(void)
+{
+    bench_sink = get_digit(bench_value, POSITION_THOUSANDS);
+}
+
+static void bench_set_to_display(void)
+{
+    set_to_display(bench_value);
+}
+
+static void bench_set_time_to_display(void)
+{
+    set_time_to_display(12U, 34U);
+}
+
+static void bench_convert_temperature(void)
+{
+    bool is_negative;
+    bench_sink = (uint16_t)convert_temperature(bench_temperature, &is_negative);
+}
+
+static void bench_temperature_frame(void)
+{
+    bench_sink = get_temperature_frame(bench_temperature);
+}
+
+static void bench_get_hours(void)
+{
+    bench_sink = DS1302_get_hours(false);
+}
+
+static void bench_get_minutes(void)
+{
+    bench_sink = DS1302_get_minutes();
+}
+
+static void bench_get_datetime(void)
+{
+    DS1302_datetime_t bench_datetime;
+
+    DS1302_get(&bench_datetime);
+    bench_sink = bench_datetime.min;
+}
+
+void APP_benchmark(void)
+{
+    BENCH_initialize();
+
+    BENCH_report(PSTR("get_digit_units"), BENCH_measure(bench_get_digit_units, false));
+    BENCH_report(PSTR("get_digit_thousands"), BENCH_measure(bench_get_digit_thousands, false));
+    BENCH_report(PSTR("set_to_display"), BENCH_measure(bench_set_to_display, false));
+    BENCH_report(PSTR("set_time_to_display"), BENCH_measure(bench_set_time_to_display, false));
+
+    settings.is_fahrenheit = false;
+    BENCH_report(PSTR("convert_celsius"), BENCH_measure(bench_convert_temperature, false));
+    settings.is_fahrenheit = true;
+    BENCH_report(PSTR("convert_fahrenheit"), BENCH_measure(bench_convert_temperature, false));
+    BENCH_report(PSTR("frame_fahrenheit"), BENCH_measure(bench_temperature_frame, false));
+    settings.is_fahrenheit = false;
+    BENCH_report(PSTR("frame_celsius"), BENCH_measure(bench_temperature_frame, false));
+
+    BENCH_report(PSTR("DS1302_get_hours"), BENCH_measure(bench_get_hours, false));
+    BENCH_report(PSTR("DS1302_get_minutes"), BENCH_measure(bench_get_minutes, false));
+    BENCH_report(PSTR("DS1302_get"), BENCH_measure(bench_get_datetime, false));
+
+    /* single pass of the screens which have their update due */
+    old_state = TIME_SCREEN;
+    state = TIME_SCREEN;
+    set_delay(0U);
+    shown_seconds = UINT8_MAX;
+    BENCH_report(PSTR("app_main_time_screen"), BENCH_measure(app_main, true));
+
+    old_state = TEMP_SCREEN;
+    state = TEMP_SCREEN;
+    set_delay(0U);
+    BENCH_report(PSTR("app_main_temp_screen"), BENCH_measure(app_main, true));
+
+    BENCH_finish();
+}
+#endif
+
 void APP_initialize(SSD_MGR_displays_t *displays, uint8_t size)
 {
-    SYSTEM_register_task(app_main, TASK_PERIOD);
+    TRACE_initialize();
+    PROF_initialize();
+    LOG_initialize();
+    SETTINGS_initialize();
+    PROF_register_task(PSTR("app"), app_main, TASK_PERIOD);
     SYSTEM_timer_register(callback);
     set_input_to_defaults(&old_input);
     old_state = SET_TIME_MODE_SCREEN;
-    app_displays = displays;
-    app_displays_size = size;
+    shown_seconds = UINT8_MAX;
+    SCREEN_initialize(displays, size);
 }
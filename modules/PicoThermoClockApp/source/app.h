@@ -22,5 +22,10 @@
  */
 #include <stdint.h>
 #include "ssd_mgr.h"
+#include "app_config.h"
 
 void APP_initialize(SSD_MGR_displays_t *displays, uint8_t size);
+
+#if BENCHMARK_ENABLED
+void APP_benchmark(void) __attribute__((noreturn));
+#endif
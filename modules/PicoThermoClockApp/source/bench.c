@@ -0,0 +1,160 @@
+/*!
+ * \file
+ * \brief Cycle counting benchmark implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "bench.h"
+
+#if BENCHMARK_ENABLED
+
+#if defined HOST
+#error "Benchmark counts cycles of the target, run it under simavr"
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+#include <util/delay.h>
+
+#define DECIMAL_BASE                (10U)
+#define MAX_DIGITS                  (10U)
+#define DRAIN_DELAY_MS              (2U)
+
+static volatile uint16_t overflows;
+static uint32_t overhead;
+
+ISR(TIMER1_OVF_vect)
+{
+    overflows++;
+}
+
+/* waits for the line, measurements are over when results are sent */
+static void send(char c)
+{
+    while((UCSRA & (1U << UDRE)) == 0U)
+    {
+    }
+
+    UDR = (uint8_t)c;
+}
+
+static void send_string_P(const char *text)
+{
+    char c;
+
+    while((c = (char)pgm_read_byte(text)) != '\0')
+    {
+        send(c);
+        text++;
+    }
+}
+
+static void send_number(uint32_t value)
+{
+    char digits[MAX_DIGITS];
+    uint8_t count = 0U;
+
+    do
+    {
+        digits[count] = (char)('0' + (value % DECIMAL_BASE));
+        value /= DECIMAL_BASE;
+        count++;
+    } while(value != 0U);
+
+    while(count != 0U)
+    {
+        count--;
+        send(digits[count]);
+    }
+}
+
+static void empty(void)
+{
+}
+
+void BENCH_initialize(void)
+{
+    TCCR1A = 0U;
+    TCCR1B = 0U;
+    overhead = 0U;
+    overhead = BENCH_measure(empty, false);
+}
+
+uint32_t BENCH_measure(BENCH_case_t test, bool is_interruptible)
+{
+    const uint8_t sreg = SREG;
+
+    cli();
+    overflows = 0U;
+    TCNT1 = 0U;
+    TIFR = (1U << TOV1);
+    TIMSK |= (1U << TOIE1);
+
+    if(is_interruptible)
+    {
+        sei();
+    }
+
+    TCCR1B = (1U << CS10);
+    test();
+    TCCR1B = 0U;
+
+    cli();
+    const uint16_t count = TCNT1;
+    uint32_t cycles = ((uint32_t)overflows << 16U) | count;
+
+    if((TIFR & (1U << TOV1)) != 0U)
+    {
+        /* overflow which was not serviced */
+        cycles += (1UL << 16U);
+    }
+
+    TIMSK &= (uint8_t)~(1U << TOIE1);
+    SREG = sreg;
+
+    return (cycles > overhead) ? (cycles - overhead) : 0U;
+}
+
+void BENCH_report(const char *name, uint32_t cycles)
+{
+    send_string_P(PSTR("BENCH "));
+    send_string_P(name);
+    send(' ');
+    send_number(cycles);
+    send('\n');
+}
+
+void BENCH_finish(void)
+{
+    send_string_P(PSTR("BENCH END\n"));
+    _delay_ms(DRAIN_DELAY_MS);
+
+    cli();
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleep_enable();
+
+    while(true)
+    {
+        sleep_cpu();
+    }
+}
+
+#endif
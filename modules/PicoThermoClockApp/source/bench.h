@@ -0,0 +1,80 @@
+/*!
+ * \file
+ * \brief Cycle counting benchmark header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app_config.h"
+
+/*!
+ *
+ * \addtogroup bench
+ * \ingroup MiniThermometer
+ * \brief Counts CPU cycles of the measured calls with Timer1 running at
+ * F_CPU and reports them over USART as "BENCH <name> <cycles>" lines
+ *
+ * \note Meant to be run under simavr, see scripts/benchmark.py. Timer1 is
+ * owned by the benchmark build.
+ */
+
+/*@{*/
+
+#if BENCHMARK_ENABLED
+
+typedef void (*BENCH_case_t)(void);
+
+/*!
+ * \brief Calibrates the measurement overhead
+ */
+void BENCH_initialize(void);
+
+/*!
+ * \brief Measures single call
+ *
+ * \param test call to be measured
+ * \param is_interruptible whether interrupts stay enabled during the call,
+ * calls with interrupts disabled shall not last longer than 65535 cycles
+ *
+ * \return number of cycles
+ */
+uint32_t BENCH_measure(BENCH_case_t test, bool is_interruptible);
+
+/*!
+ * \brief Sends the result
+ *
+ * \param name name of the result stored in program space
+ * \param cycles number of cycles
+ */
+void BENCH_report(const char *name, uint32_t cycles);
+
+/*!
+ * \brief Ends the benchmark, simulator quits when CPU sleeps with
+ * interrupts disabled
+ */
+void BENCH_finish(void) __attribute__((noreturn));
+
+#endif
+
+/*@}*/
+#endif /* end of BENCH_H */
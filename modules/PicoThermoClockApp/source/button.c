@@ -0,0 +1,181 @@
+/*!
+ * \file
+ * \brief Interrupt driven button capture implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "button.h"
+
+#if INPUT_CAPTURE_ENABLED
+
+#if defined HOST
+#error "Host has no external interrupts, use the input manager"
+#endif
+
+#include "hardware.h"
+#include "uptime.h"
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <stdbool.h>
+
+#define BUTTONS_COUNT               (2U)
+#define QUEUE_MASK                  (BUTTON_QUEUE_SIZE - 1U)
+
+typedef char queue_size_is_power_of_2[((BUTTON_QUEUE_SIZE & QUEUE_MASK) == 0U) ? 1 : -1];
+
+/* times are kept as the low 16 bits of the uptime, events are taken long
+ * before they wrap */
+typedef struct
+{
+    INPUT_MGR_event_t event;
+    uint16_t time;
+} queued_event_t;
+
+#define PLUS_MASK                   (uint8_t)(1U << INPUT_PLUS_PIN)
+#define MINUS_MASK                  (uint8_t)(1U << INPUT_MINUS_PIN)
+
+/* INT0 is PD2 and INT1 is PD3 on the atmega8, the board must wire the buttons there */
+typedef char buttons_on_int_pins[((INPUT_PLUS_PORT == GPIO_PORTD) && (INPUT_PLUS_PIN == PD2) &&
+        (INPUT_MINUS_PORT == GPIO_PORTD) && (INPUT_MINUS_PIN == PD3)) ? 1 : -1];
+
+/* buttons pull the pins low */
+static const uint8_t pins[BUTTONS_COUNT] =
+{
+    [INPUT_MINUS_ID] = MINUS_MASK,
+    [INPUT_PLUS_ID] = PLUS_MASK,
+};
+
+/* pins which changed since the last tick */
+static volatile uint8_t edges;
+/* milliseconds until the pin is read, restarted by every edge */
+static uint8_t debounce[BUTTONS_COUNT];
+static uint16_t first_edge[BUTTONS_COUNT];
+static bool is_pressed[BUTTONS_COUNT];
+/* milliseconds until the long press, 0 when released or already reported */
+static uint16_t hold[BUTTONS_COUNT];
+static queued_event_t queue[BUTTON_QUEUE_SIZE];
+static uint8_t head;
+static uint8_t tail;
+static uint16_t event_time;
+
+ISR(INT0_vect)
+{
+    edges |= PLUS_MASK;
+}
+
+ISR(INT1_vect)
+{
+    edges |= MINUS_MASK;
+}
+
+/* called with interrupts disabled, full queue drops the event */
+static void push(uint8_t id, uint8_t event, uint16_t time)
+{
+    const uint8_t next = (head + 1U) & QUEUE_MASK;
+
+    if(next != tail)
+    {
+        queue[head].event.id = id;
+        queue[head].event.event = event;
+        queue[head].time = time;
+        head = next;
+    }
+}
+
+void BUTTON_initialize(void)
+{
+    /* any logical change on INT0 and INT1 */
+    MCUCR = (uint8_t)((MCUCR & ~((1U << ISC11) | (1U << ISC01))) |
+            (1U << ISC10) | (1U << ISC00));
+    GIFR = (1U << INTF1) | (1U << INTF0);
+    GICR |= (1U << INT1) | (1U << INT0);
+
+    /* picks up buttons held during the start */
+    edges = MINUS_MASK | PLUS_MASK;
+}
+
+void BUTTON_tick(void)
+{
+    const uint16_t now = (uint16_t)UPTIME_get_ms();
+    uint8_t changed;
+
+    /* an edge between the read and the clear would be lost */
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        changed = edges;
+        edges = 0U;
+    }
+
+    for(uint8_t id = 0U; id < BUTTONS_COUNT; id++)
+    {
+        if((changed & pins[id]) != 0U)
+        {
+            if(debounce[id] == 0U)
+            {
+                first_edge[id] = now;
+            }
+
+            debounce[id] = BUTTON_DEBOUNCE_TIME;
+        }
+        else if((debounce[id] != 0U) && (--debounce[id] == 0U))
+        {
+            const bool is_low = ((PIND & pins[id]) == 0U);
+
+            if(is_low != is_pressed[id])
+            {
+                is_pressed[id] = is_low;
+                hold[id] = is_low ? BUTTON_LONG_PRESS_TIME : 0U;
+                push(id, is_low ? BUTTON_SHORT_PRESSED : BUTTON_RELEASED, first_edge[id]);
+            }
+        }
+
+        if((hold[id] != 0U) && (--hold[id] == 0U))
+        {
+            push(id, BUTTON_LONG_PRESSED, now);
+        }
+    }
+}
+
+int8_t BUTTON_get_event(INPUT_MGR_event_t *event)
+{
+    int8_t ret = -1;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        if(head != tail)
+        {
+            *event = queue[tail].event;
+            event_time = queue[tail].time;
+            tail = (tail + 1U) & QUEUE_MASK;
+            ret = 0;
+        }
+    }
+
+    return ret;
+}
+
+uint32_t BUTTON_get_event_time(void)
+{
+    const uint32_t now = UPTIME_get_ms();
+
+    return now - (uint16_t)((uint16_t)now - event_time);
+}
+
+#endif
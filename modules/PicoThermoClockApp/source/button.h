@@ -0,0 +1,79 @@
+/*!
+ * \file
+ * \brief Interrupt driven button capture header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef BUTTON_H
+#define BUTTON_H
+
+#include <stdint.h>
+#include "app_config.h"
+#include "input_mgr.h"
+
+/*!
+ *
+ * \addtogroup button
+ * \ingroup MiniThermometer
+ * \brief Captures edges of PLUS and MINUS buttons with INT0/INT1 interrupts
+ * and turns them into the same events as the input manager produces
+ *
+ * \note Interrupt only marks the pin as changed. The timer callback stamps
+ * the edge and reads the pin once it has been quiet for BUTTON_DEBOUNCE_TIME,
+ * so no pin is scanned while the buttons are idle. Events are stamped with the time of the
+ * first edge of the press or release. When the capture is disabled the input
+ * manager polls the buttons.
+ */
+
+/*@{*/
+
+#define BUTTON_DEBOUNCE_TIME        (20U)
+#define BUTTON_LONG_PRESS_TIME      (1000U)
+#define BUTTON_QUEUE_SIZE           (4U)
+
+#if INPUT_CAPTURE_ENABLED
+void BUTTON_initialize(void);
+
+/*!
+ * \brief Debounces the buttons, shall be called from the system timer callback
+ */
+void BUTTON_tick(void);
+
+/*!
+ * \brief Returns the next button event
+ *
+ * \param event id of the button and BUTTON_SHORT_PRESSED, BUTTON_LONG_PRESSED
+ * or BUTTON_RELEASED
+ *
+ * \retval 0 event returned
+ * \retval -1 no event
+ */
+int8_t BUTTON_get_event(INPUT_MGR_event_t *event);
+
+/*!
+ * \brief Returns uptime in milliseconds at which the event last returned by
+ * BUTTON_get_event happened
+ */
+uint32_t BUTTON_get_event_time(void);
+#else
+#define BUTTON_tick()               do {} while(0)
+#endif
+
+/*@}*/
+#endif /* end of BUTTON_H */
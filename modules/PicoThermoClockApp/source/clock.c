@@ -0,0 +1,194 @@
+/*!
+ * \file
+ * \brief Cached real time clock implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "clock.h"
+#include "trace.h"
+#include <util/atomic.h>
+
+#define MS_PER_SECOND               (1000U)
+#define SECONDS_PER_MINUTE          (60U)
+#define MINUTES_PER_HOUR            (60U)
+#define HOURS_PER_DAY               (24U)
+#define HOURS_12H                   (12U)
+
+/* reads start this many milliseconds before the expected change */
+#define HUNT_WINDOW                 (200U)
+/* passes of the application task after which the hunt gives up, e.g. when
+ * the RTC is halted */
+#define HUNT_TIMEOUT                (12U)
+
+typedef enum
+{
+    UNSYNCED,
+    HUNTING,
+    SYNCED,
+} clock_state_t;
+
+/* changed only by the timer callback, other accesses are atomic blocks */
+static CLOCK_time_t now;
+static clock_state_t state;
+static uint8_t hunted_seconds;
+static uint8_t hunt_passes;
+static uint8_t counted_seconds;
+static uint8_t resync_countdown;
+
+void CLOCK_tick(void)
+{
+    now.ms++;
+
+    if(now.ms < MS_PER_SECOND)
+    {
+        return;
+    }
+
+    now.ms = 0U;
+    now.secs++;
+
+    if(now.secs < SECONDS_PER_MINUTE)
+    {
+        return;
+    }
+
+    now.secs = 0U;
+    now.min++;
+
+    if(now.min < MINUTES_PER_HOUR)
+    {
+        return;
+    }
+
+    now.min = 0U;
+    now.hours++;
+
+    if(now.hours >= HOURS_PER_DAY)
+    {
+        now.hours = 0U;
+    }
+}
+
+/* returns true when the seconds of the RTC differ from the hunted ones */
+static bool read_clock(void)
+{
+    DS1302_datetime_t datetime;
+
+    TRACE_get_datetime(&datetime);
+
+    if((datetime.secs == hunted_seconds) && (hunt_passes < HUNT_TIMEOUT))
+    {
+        hunt_passes++;
+        return false;
+    }
+
+    uint8_t hours = datetime.hours;
+
+    if(datetime.is_12h_mode)
+    {
+        hours = (uint8_t)((hours % HOURS_12H) + (datetime.is_pm ? HOURS_12H : 0U));
+    }
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        now.hours = hours;
+        now.min = datetime.min;
+        now.secs = datetime.secs;
+        now.ms = 0U;
+    }
+
+    counted_seconds = datetime.secs;
+    resync_countdown = CLOCK_RESYNC_PERIOD;
+    return true;
+}
+
+void CLOCK_main(void)
+{
+    uint16_t ms;
+    uint8_t secs;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        ms = now.ms;
+        secs = now.secs;
+    }
+
+    switch(state)
+    {
+        case UNSYNCED:
+            /* no second can match, so the first read is taken as it is */
+            hunted_seconds = UINT8_MAX;
+            hunt_passes = 0U;
+            (void)read_clock();
+            hunted_seconds = counted_seconds;
+            state = HUNTING;
+            break;
+        case HUNTING:
+            if(read_clock())
+            {
+                state = SYNCED;
+            }
+            break;
+        case SYNCED:
+            if(secs != counted_seconds)
+            {
+                counted_seconds = secs;
+
+                if(resync_countdown != 0U)
+                {
+                    resync_countdown--;
+                }
+            }
+
+            if((resync_countdown == 0U) && (ms >= (MS_PER_SECOND - HUNT_WINDOW)))
+            {
+                /* copy is aligned, so the RTC shows the same seconds */
+                hunted_seconds = secs;
+                hunt_passes = 0U;
+                state = HUNTING;
+            }
+            break;
+        default:
+            state = UNSYNCED;
+            break;
+    }
+}
+
+void CLOCK_resync(void)
+{
+    state = UNSYNCED;
+}
+
+void CLOCK_get(CLOCK_time_t *time, bool is_12h_mode)
+{
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        time->hours = now.hours;
+        time->min = now.min;
+        time->secs = now.secs;
+        time->ms = now.ms;
+    }
+
+    if(is_12h_mode)
+    {
+        const uint8_t hours = time->hours % HOURS_12H;
+
+        time->hours = (hours == 0U) ? HOURS_12H : hours;
+    }
+}
@@ -0,0 +1,82 @@
+/*!
+ * \file
+ * \brief Cached real time clock header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup clock
+ * \ingroup MiniThermometer
+ * \brief Keeps a copy of the DS1302 time, which is advanced locally from
+ * the system timer
+ *
+ * \note The clock is read in one go (DS1302_get) on start, after a resync
+ * request and once every CLOCK_RESYNC_PERIOD seconds. Reads start shortly
+ * before the expected change of the seconds and repeat every pass of the
+ * application task until the seconds of the RTC change, then milliseconds of
+ * the copy start from zero. The copy is within one task period of the RTC.
+ */
+
+/*@{*/
+
+#define CLOCK_RESYNC_PERIOD         (60U)
+#define CLOCK_HALF_SECOND           (500U)
+
+typedef struct
+{
+    uint8_t hours;
+    uint8_t min;
+    uint8_t secs;
+    uint16_t ms;
+} CLOCK_time_t;
+
+/*!
+ * \brief Counts a millisecond, shall be called from the system timer callback
+ */
+void CLOCK_tick(void);
+
+/*!
+ * \brief Reads the RTC when the copy is due to be aligned, shall be called
+ * from the application task
+ */
+void CLOCK_main(void);
+
+/*!
+ * \brief Reads the whole clock again and aligns to its seconds, e.g. after
+ * the RTC was set
+ */
+void CLOCK_resync(void);
+
+/*!
+ * \brief Returns current time
+ *
+ * \param time current time
+ * \param is_12h_mode format of the returned hours
+ */
+void CLOCK_get(CLOCK_time_t *time, bool is_12h_mode);
+
+/*@}*/
+#endif /* end of CLOCK_H */
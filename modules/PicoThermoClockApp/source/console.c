@@ -0,0 +1,134 @@
+/*!
+ * \file
+ * \brief USART command console implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "console.h"
+
+#if CONSOLE_ENABLED
+
+#include "serial.h"
+#include "debug.h"
+#include <avr/pgmspace.h>
+#include <stddef.h>
+
+#define DECIMAL_BASE                (10U)
+#define MAX_DIGITS                  (10U)
+
+typedef char line_fits_serial_buffer[(CONSOLE_LINE_SIZE < SERIAL_BUFFER_SIZE) ? 1 : -1];
+
+typedef struct
+{
+    char command;
+    CONSOLE_handler_t handler;
+} command_t;
+
+static command_t commands[CONSOLE_MAX_COMMANDS];
+static uint8_t commands_count;
+static CONSOLE_handler_t pending;
+static char line[CONSOLE_LINE_SIZE];
+static uint8_t line_length;
+
+void CONSOLE_main(void)
+{
+    uint8_t data;
+
+    if(pending == NULL)
+    {
+        if(SERIAL_read(&data) != 0)
+        {
+            return;
+        }
+
+        for(uint8_t i = 0U; i < commands_count; i++)
+        {
+            if(commands[i].command == (char)data)
+            {
+                pending = commands[i].handler;
+            }
+        }
+    }
+
+    if((pending != NULL) && pending())
+    {
+        pending = NULL;
+    }
+}
+
+void CONSOLE_register_command(char command, CONSOLE_handler_t handler)
+{
+    ASSERT(commands_count < CONSOLE_MAX_COMMANDS);
+
+    commands[commands_count].command = command;
+    commands[commands_count].handler = handler;
+    commands_count++;
+}
+
+void CONSOLE_write_char(char c)
+{
+    if(line_length < CONSOLE_LINE_SIZE)
+    {
+        line[line_length] = c;
+        line_length++;
+    }
+}
+
+void CONSOLE_write_P(const char *text)
+{
+    char c;
+
+    while((c = (char)pgm_read_byte(text)) != '\0')
+    {
+        CONSOLE_write_char(c);
+        text++;
+    }
+}
+
+void CONSOLE_write_number(uint32_t value)
+{
+    char digits[MAX_DIGITS];
+    uint8_t count = 0U;
+
+    do
+    {
+        digits[count] = (char)('0' + (value % DECIMAL_BASE));
+        value /= DECIMAL_BASE;
+        count++;
+    } while(value != 0U);
+
+    while(count != 0U)
+    {
+        count--;
+        CONSOLE_write_char(digits[count]);
+    }
+}
+
+bool CONSOLE_flush(void)
+{
+    if((line_length != 0U) && !SERIAL_write((const uint8_t *)line, line_length))
+    {
+        return false;
+    }
+
+    line_length = 0U;
+    return true;
+}
+
+#endif
@@ -0,0 +1,96 @@
+/*!
+ * \file
+ * \brief USART command console header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app_config.h"
+
+/*!
+ *
+ * \addtogroup console
+ * \ingroup MiniThermometer
+ * \brief Single character commands received over USART, with helpers for
+ * sending plain text reports back
+ *
+ * \note The console has no task of its own, CONSOLE_main is polled from the
+ * application task. Text is collected into a line and the whole line is
+ * queued in the serial buffer at once, a handler which sends more than one
+ * line returns false and is called again on the next pass, until the
+ * buffer had room for all of them.
+ */
+
+/*@{*/
+
+#define CONSOLE_MAX_COMMANDS        (3U)
+#define CONSOLE_LINE_SIZE           (60U)
+
+/*!
+ * \brief Command handler
+ *
+ * \retval true command finished
+ * \retval false command shall be called again on the next pass
+ */
+typedef bool (*CONSOLE_handler_t)(void);
+
+#if CONSOLE_ENABLED
+/*!
+ * \brief Receives commands and runs the handler of pending one, shall be
+ * called from the application task
+ */
+void CONSOLE_main(void);
+
+/*!
+ * \brief Registers command
+ *
+ * \param command character which triggers the handler
+ * \param handler handler called from CONSOLE_main
+ */
+void CONSOLE_register_command(char command, CONSOLE_handler_t handler);
+
+void CONSOLE_write_char(char c);
+
+/*!
+ * \brief Writes string stored in program space
+ */
+void CONSOLE_write_P(const char *text);
+
+/*!
+ * \brief Writes number in decimal form
+ */
+void CONSOLE_write_number(uint32_t value);
+
+/*!
+ * \brief Queues collected line in the serial buffer
+ *
+ * \retval true line queued or nothing to queue
+ * \retval false no room in the serial buffer, line is kept for next try
+ */
+bool CONSOLE_flush(void);
+#else
+#define CONSOLE_main()              do {} while(0)
+#endif
+
+/*@}*/
+#endif /* end of CONSOLE_H */
@@ -0,0 +1,145 @@
+/*!
+ * \file
+ * \brief EEPROM write queue implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "ee_queue.h"
+#include <avr/eeprom.h>
+#if !defined HOST
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#endif
+
+#define QUEUE_MASK                  (EE_QUEUE_SIZE - 1U)
+
+typedef char queue_size_is_power_of_2[((EE_QUEUE_SIZE & QUEUE_MASK) == 0U) ? 1 : -1];
+
+typedef struct
+{
+    uint8_t *address;
+    uint8_t value;
+} entry_t;
+
+static entry_t queue[EE_QUEUE_SIZE];
+static uint8_t head;
+/* moved by the interrupt */
+static volatile uint8_t tail;
+
+#if defined HOST
+void EE_QUEUE_tick(void)
+{
+    if(head == tail)
+    {
+        return;
+    }
+
+    eeprom_update_byte(queue[tail].address, queue[tail].value);
+    tail = (tail + 1U) & QUEUE_MASK;
+}
+#else
+ISR(EE_RDY_vect)
+{
+    while(tail != head)
+    {
+        const entry_t *entry = &queue[tail];
+
+        tail = (tail + 1U) & QUEUE_MASK;
+        EEAR = (uint16_t)(uintptr_t)entry->address;
+        EECR |= (1U << EERE);
+
+        if(EEDR != entry->value)
+        {
+            EEDR = entry->value;
+            EECR |= (1U << EEMWE);
+            EECR |= (1U << EEWE);
+            return;
+        }
+    }
+
+    EECR &= (uint8_t)~(1U << EERIE);
+}
+#endif
+
+bool EE_QUEUE_write(void *dst, const void *src, uint8_t size)
+{
+    const uint8_t room = (uint8_t)(QUEUE_MASK - ((head - tail) & QUEUE_MASK));
+
+    if(size > room)
+    {
+        return false;
+    }
+
+    uint8_t *address = dst;
+    const uint8_t *data = src;
+    uint8_t next = head;
+
+    for(uint8_t i = 0U; i < size; i++)
+    {
+        queue[next].address = &address[i];
+        queue[next].value = data[i];
+        next = (next + 1U) & QUEUE_MASK;
+    }
+
+    /* entries are complete in memory before the interrupt may take them */
+    __asm__ __volatile__("" ::: "memory");
+    head = next;
+#if !defined HOST
+    EECR |= (1U << EERIE);
+#endif
+    return true;
+}
+
+void EE_QUEUE_read(void *dst, const void *src, uint8_t size)
+{
+    uint8_t *data = dst;
+
+#if !defined HOST
+    /* interrupt doesn't start the next write while EEAR is used for reading */
+    EECR &= (uint8_t)~(1U << EERIE);
+#endif
+    /* waits for the write in progress */
+    eeprom_read_block(dst, src, size);
+
+    for(uint8_t i = tail; i != head; i = (i + 1U) & QUEUE_MASK)
+    {
+        const uintptr_t offset = (uintptr_t)queue[i].address - (uintptr_t)src;
+
+        if(offset < size)
+        {
+            data[offset] = queue[i].value;
+        }
+    }
+
+#if !defined HOST
+    if(head != tail)
+    {
+        EECR |= (1U << EERIE);
+    }
+#endif
+}
+
+bool EE_QUEUE_is_done(void)
+{
+#if defined HOST
+    return (head == tail);
+#else
+    return (head == tail) && ((EECR & (1U << EEWE)) == 0U);
+#endif
+}
@@ -0,0 +1,89 @@
+/*!
+ * \file
+ * \brief EEPROM write queue header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef EE_QUEUE_H
+#define EE_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup ee_queue
+ * \ingroup MiniThermometer
+ * \brief Non-blocking EEPROM writes drained by the EE_READY interrupt
+ *
+ * \note Bytes are queued with their addresses in a RAM ring. The interrupt
+ * is enabled while the queue isn't empty and starts the next write as soon
+ * as the previous one is done, bytes which already hold the value are
+ * skipped. Bytes are written in the order they were queued, so a record
+ * whose validity byte is queued last is never seen complete before it is.
+ * Reads go through the queue, a byte still pending is returned with its
+ * queued value. On the host the system timer callback writes one byte per
+ * millisecond instead of the interrupt.
+ */
+
+/*@{*/
+
+#define EE_QUEUE_SIZE               (32U)
+
+/*!
+ * \brief Queues bytes for writing, all of them or none
+ *
+ * \param dst EEPROM address
+ * \param src bytes to be written
+ * \param size number of bytes
+ *
+ * \retval true bytes queued
+ * \retval false not enough room, nothing queued
+ */
+bool EE_QUEUE_write(void *dst, const void *src, uint8_t size);
+
+/*!
+ * \brief Reads bytes, pending ones are taken from the queue
+ *
+ * \param dst storage for read bytes
+ * \param src EEPROM address
+ * \param size number of bytes
+ */
+void EE_QUEUE_read(void *dst, const void *src, uint8_t size);
+
+/*!
+ * \brief Tells if all queued bytes are written
+ *
+ * \retval true nothing pending
+ * \retval false writes in progress
+ */
+bool EE_QUEUE_is_done(void);
+
+#if defined HOST
+/*!
+ * \brief Writes next queued byte, shall be called from the system timer
+ * callback
+ */
+void EE_QUEUE_tick(void);
+#else
+#define EE_QUEUE_tick()             do {} while(0)
+#endif
+
+/*@}*/
+#endif /* end of EE_QUEUE_H */
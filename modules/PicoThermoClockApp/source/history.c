@@ -0,0 +1,190 @@
+/*!
+ * \file
+ * \brief Temperature statistics implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "history.h"
+#include "sensor.h"
+#include "uptime.h"
+#include "log.h"
+#include <avr/pgmspace.h>
+
+/* 1/4 of degree with an offset keeps values unsigned and sums in 16 bits */
+#define VALUE_SHIFT                 (2U)
+#define VALUE_OFFSET                (1024)
+#define SAMPLE_LIMIT                (VALUE_OFFSET << VALUE_SHIFT)
+#define BUCKETS                     (4U + 6U + 7U)
+#define HOUR_PARTS                  (15U)
+
+typedef struct
+{
+    uint8_t offset;
+    uint8_t size;
+    uint8_t parts;  /* samples or closed buckets of the shorter window */
+} window_config_t;
+
+static const window_config_t windows[HISTORY_WINDOWS] PROGMEM =
+{
+    { 0U,   4U,     HOUR_PARTS },   /* 4 x 15 min */
+    { 4U,   6U,     16U },          /* 6 x 4 h */
+    { 10U,  7U,     6U },           /* 7 x 1 day */
+};
+
+/* the log takes closed buckets of the hour */
+typedef char log_period_is_bucket[(LOG_PERIOD_MINUTES * 60000UL == HOUR_PARTS * HISTORY_PERIOD) ? 1 : -1];
+/* bucket sums at most 16 values up to 2 * VALUE_OFFSET */
+typedef char sum_fits_16_bits[(16UL * 2UL * VALUE_OFFSET < UINT16_MAX) ? 1 : -1];
+
+static uint16_t mins[BUCKETS];
+static uint16_t maxs[BUCKETS];
+static uint16_t sums[BUCKETS];
+static uint8_t counts[BUCKETS];
+static uint8_t parts[HISTORY_WINDOWS];
+static uint8_t indexes[HISTORY_WINDOWS];
+static uint32_t next = HISTORY_PERIOD;
+
+static int16_t to_temperature(uint16_t value)
+{
+    return (int16_t)(((int16_t)value - VALUE_OFFSET) * (1 << VALUE_SHIFT));
+}
+
+static uint8_t get_bucket(uint8_t window)
+{
+    return pgm_read_byte(&windows[window].offset) + indexes[window];
+}
+
+static uint16_t get_mean(uint16_t sum, uint8_t count)
+{
+    return (sum + (count / 2U)) / count;
+}
+
+static void add(uint8_t bucket, uint16_t min, uint16_t max, uint16_t mean)
+{
+    if((counts[bucket] == 0U) || (min < mins[bucket]))
+    {
+        mins[bucket] = min;
+    }
+
+    if((counts[bucket] == 0U) || (max > maxs[bucket]))
+    {
+        maxs[bucket] = max;
+    }
+
+    sums[bucket] += mean;
+    counts[bucket]++;
+}
+
+/* a closed bucket is one part of the running bucket of the next window */
+static void count_part(void)
+{
+    for(uint8_t window = 0U; window < HISTORY_WINDOWS; window++)
+    {
+        parts[window]++;
+
+        if(parts[window] != pgm_read_byte(&windows[window].parts))
+        {
+            return;
+        }
+
+        const uint8_t closed = get_bucket(window);
+
+        parts[window] = 0U;
+        indexes[window]++;
+
+        if(indexes[window] == pgm_read_byte(&windows[window].size))
+        {
+            indexes[window] = 0U;
+        }
+
+        /* oldest bucket of the ring is reused */
+        sums[get_bucket(window)] = 0U;
+        counts[get_bucket(window)] = 0U;
+
+        const bool has_samples = (counts[closed] != 0U);
+        const uint16_t mean = has_samples ? get_mean(sums[closed], counts[closed]) : 0U;
+
+        if(window == HISTORY_HOUR)
+        {
+            LOG_add(has_samples, to_temperature(mean));
+        }
+
+        if(((window + 1U) < HISTORY_WINDOWS) && has_samples)
+        {
+            add(get_bucket(window + 1U), mins[closed], maxs[closed], mean);
+        }
+    }
+}
+
+void HISTORY_main(void)
+{
+    const uint32_t now = UPTIME_get_ms();
+
+    if((int32_t)(now - next) < 0)
+    {
+        return;
+    }
+
+    int16_t temperature;
+
+    next = now + HISTORY_PERIOD;
+
+    /* missing samples still count, so buckets keep following the time */
+    if(SENSOR_get_temperature(&temperature) &&
+            (temperature > -SAMPLE_LIMIT) && (temperature < SAMPLE_LIMIT))
+    {
+        const uint16_t value =
+            (uint16_t)(((temperature + (1 << (VALUE_SHIFT - 1U))) >> VALUE_SHIFT) + VALUE_OFFSET);
+
+        add(get_bucket(HISTORY_HOUR), value, value, value);
+    }
+
+    count_part();
+}
+
+bool HISTORY_get(uint8_t window, HISTORY_summary_t *summary)
+{
+    const uint8_t offset = pgm_read_byte(&windows[window].offset);
+    const uint8_t end = offset + pgm_read_byte(&windows[window].size);
+    uint16_t min = UINT16_MAX;
+    uint16_t max = 0U;
+    uint16_t sum = 0U;
+    uint8_t count = 0U;
+
+    for(uint8_t i = offset; i < end; i++)
+    {
+        if(counts[i] != 0U)
+        {
+            min = (mins[i] < min) ? mins[i] : min;
+            max = (maxs[i] > max) ? maxs[i] : max;
+            sum += get_mean(sums[i], counts[i]);
+            count++;
+        }
+    }
+
+    if(count == 0U)
+    {
+        return false;
+    }
+
+    summary->min = to_temperature(min);
+    summary->max = to_temperature(max);
+    summary->mean = to_temperature(get_mean(sum, count));
+    return true;
+}
@@ -0,0 +1,79 @@
+/*!
+ * \file
+ * \brief Temperature statistics header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup history
+ * \ingroup MiniThermometer
+ * \brief Minimum, maximum and mean temperature of the last hour, day and week
+ *
+ * \note Filtered temperature is folded into the running bucket of the hour
+ * every HISTORY_PERIOD, samples themselves are never stored. Each window is
+ * a ring of buckets: 4 x 15 min for the hour, 6 x 4 h for the day and 7 x 1
+ * day for the week. The running bucket is the newest one of the ring. When
+ * it closes, its mean, minimum and maximum are folded into the running
+ * bucket of the next window and the oldest bucket of the ring is reused, so
+ * a window covers between its length less one bucket and its whole length.
+ * Values are kept in 1/4 of degree.
+ */
+
+/*@{*/
+
+#define HISTORY_HOUR                (0U)
+#define HISTORY_DAY                 (1U)
+#define HISTORY_WEEK                (2U)
+#define HISTORY_WINDOWS             (3U)
+
+#define HISTORY_PERIOD              (60000UL)
+
+typedef struct
+{
+    int16_t min;
+    int16_t max;
+    int16_t mean;
+} HISTORY_summary_t;
+
+/*!
+ * \brief Takes a sample when it's due, shall be called from the application
+ * task
+ */
+void HISTORY_main(void);
+
+/*!
+ * \brief Returns statistics of the window
+ *
+ * \param window HISTORY_HOUR, HISTORY_DAY or HISTORY_WEEK
+ * \param summary minimum, maximum and mean in units of the sensor
+ *
+ * \retval true summary returned
+ * \retval false no samples in the window yet
+ */
+bool HISTORY_get(uint8_t window, HISTORY_summary_t *summary);
+
+/*@}*/
+#endif /* end of HISTORY_H */
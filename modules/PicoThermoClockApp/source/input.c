@@ -0,0 +1,41 @@
+/*!
+ * \file
+ * \brief Timestamped input events implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "input.h"
+#include "button.h"
+#include "trace.h"
+#include "uptime.h"
+
+int8_t INPUT_get_event(INPUT_event_t *event)
+{
+    if(TRACE_get_input_event(&event->event) != 0)
+    {
+        return -1;
+    }
+
+#if INPUT_CAPTURE_ENABLED
+    event->timestamp = BUTTON_get_event_time();
+#else
+    event->timestamp = UPTIME_get_ms();
+#endif
+    return 0;
+}
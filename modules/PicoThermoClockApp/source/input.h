@@ -0,0 +1,61 @@
+/*!
+ * \file
+ * \brief Timestamped input events header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+#include "input_mgr.h"
+
+/*!
+ *
+ * \addtogroup input
+ * \ingroup MiniThermometer
+ * \brief Button events with their uptime timestamps, the application
+ * drains all pending ones on every pass instead of one per pass
+ *
+ * \note With the interrupt capture events come stamped with the time of the
+ * button edge. InputMgr keeps the pending events without time, they are
+ * stamped when they are taken from it, so the timestamp has the resolution of
+ * the task period.
+ */
+
+/*@{*/
+
+typedef struct
+{
+    INPUT_MGR_event_t event;
+    uint32_t timestamp;
+} INPUT_event_t;
+
+/*!
+ * \brief Takes the oldest pending event
+ *
+ * \param event event and its timestamp
+ *
+ * \retval 0 event returned
+ * \retval -1 no pending event
+ */
+int8_t INPUT_get_event(INPUT_event_t *event);
+
+/*@}*/
+#endif /* end of INPUT_H */
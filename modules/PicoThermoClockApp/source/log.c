@@ -0,0 +1,203 @@
+/*!
+ * \file
+ * \brief Persistent temperature log implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "log.h"
+
+#if LOG_ENABLED
+
+#include "serial.h"
+#include "console.h"
+#include "trace.h"
+#include "ee_queue.h"
+#include <avr/eeprom.h>
+#include <stddef.h>
+
+#define MAX_MONTH                   (12U)
+
+/* entry is the change of temperature plus DELTA_OFFSET, or one of the codes,
+ * bigger changes are spread over the following entries */
+#define NOT_WRITTEN                 (0xFFU)
+#define NO_SAMPLE                   (0xFEU)
+#define DELTA_OFFSET                (128)
+#define DELTA_LIMIT                 (125)
+#define VALUE_SHIFT                 (2U)
+
+#define CHUNK_SIZE                  (16U)
+#define HEADER_SIZE                 (1U + sizeof(DS1302_datetime_t) + sizeof(int16_t))
+#define ENTRIES                     (LOG_BLOCK_SIZE - HEADER_SIZE)
+/* header after the sequence number up to the first entry */
+#define HEADER_RUN_SIZE             (offsetof(block_t, entries) + 1U - offsetof(block_t, datetime))
+
+typedef struct
+{
+    uint8_t sequence;
+    DS1302_datetime_t datetime;
+    int16_t base;   /* temperature of the first entry in 1/4 of degree */
+    uint8_t entries[ENTRIES];
+} block_t;
+
+typedef char block_size_is_exact[(sizeof(block_t) == LOG_BLOCK_SIZE) ? 1 : -1];
+typedef char chunks_fill_log[((LOG_BLOCKS * LOG_BLOCK_SIZE) % CHUNK_SIZE == 0U) ? 1 : -1];
+typedef char chunk_fits_serial_buffer[(CHUNK_SIZE < SERIAL_BUFFER_SIZE) ? 1 : -1];
+
+static block_t EEMEM blocks[LOG_BLOCKS];
+static uint8_t block = LOG_BLOCKS - 1U;
+static uint8_t sequence = UINT8_MAX;
+static uint8_t entry = ENTRIES;     /* ENTRIES when the next entry opens a new block */
+static uint8_t *cursor;             /* next entry of the open block */
+static int16_t last;                /* temperature the written changes add up to */
+static uint16_t dumped;
+static bool is_dumping;
+
+static bool is_month_valid(uint8_t month)
+{
+    return (month != 0U) && (month <= MAX_MONTH);
+}
+
+static bool open_block(int16_t base)
+{
+    block_t header;
+
+    TRACE_get_datetime(&header.datetime);
+
+    if(!is_month_valid(header.datetime.month))
+    {
+        return false;
+    }
+
+    const uint8_t next = (block + 1U == LOG_BLOCKS) ? 0U : block + 1U;
+
+    header.sequence = (uint8_t)(sequence + 1U);
+    header.base = base;
+    header.entries[0] = NOT_WRITTEN;
+
+    /* sequence number goes last, a torn header doesn't make the block the newest */
+    if(!EE_QUEUE_write(&blocks[next].datetime, &header.datetime, HEADER_RUN_SIZE) ||
+            !EE_QUEUE_write(&blocks[next].sequence, &header.sequence, sizeof(header.sequence)))
+    {
+        return false;
+    }
+
+    block = next;
+    sequence = header.sequence;
+    cursor = blocks[block].entries;
+    entry = 0U;
+    last = base;
+    return true;
+}
+
+static bool dump(void)
+{
+    if(!is_dumping)
+    {
+        const uint8_t preamble[] = { LOG_MAGIC, LOG_BLOCKS, LOG_BLOCK_SIZE, LOG_PERIOD_MINUTES };
+
+        if(!SERIAL_write(preamble, sizeof(preamble)))
+        {
+            return false;
+        }
+
+        is_dumping = true;
+        dumped = 0U;
+    }
+
+    while(dumped < sizeof(blocks))
+    {
+        uint8_t chunk[CHUNK_SIZE];
+
+        EE_QUEUE_read(chunk, (const uint8_t *)blocks + dumped, CHUNK_SIZE);
+
+        if(!SERIAL_write(chunk, CHUNK_SIZE))
+        {
+            return false;
+        }
+
+        dumped += CHUNK_SIZE;
+    }
+
+    is_dumping = false;
+    return true;
+}
+
+void LOG_initialize(void)
+{
+    /* ring is written in order, so the newest block ends the run of sequence numbers */
+    if(is_month_valid(eeprom_read_byte(&blocks[0].datetime.month)))
+    {
+        block = 0U;
+        sequence = eeprom_read_byte(&blocks[0].sequence);
+
+        while(((block + 1U) < LOG_BLOCKS) &&
+                is_month_valid(eeprom_read_byte(&blocks[block + 1U].datetime.month)) &&
+                (eeprom_read_byte(&blocks[block + 1U].sequence) == (uint8_t)(sequence + 1U)))
+        {
+            block++;
+            sequence++;
+        }
+    }
+
+    CONSOLE_register_command('l', dump);
+}
+
+void LOG_add(bool is_valid, int16_t temperature)
+{
+    const int16_t value = (int16_t)(temperature + (1 << (VALUE_SHIFT - 1U))) >> VALUE_SHIFT;
+
+    if((entry == ENTRIES) && !open_block(is_valid ? value : 0))
+    {
+        return;
+    }
+
+    uint8_t code = NO_SAMPLE;
+    int16_t delta = 0;
+
+    if(is_valid)
+    {
+        delta = value - last;
+
+        if(delta > DELTA_LIMIT)
+        {
+            delta = DELTA_LIMIT;
+        }
+        else if(delta < -DELTA_LIMIT)
+        {
+            delta = -DELTA_LIMIT;
+        }
+
+        code = (uint8_t)(delta + DELTA_OFFSET);
+    }
+
+    /* following entry is cleared first, so the block always ends with a not written one */
+    const uint8_t not_written = NOT_WRITTEN;
+
+    if(((entry + 1U < ENTRIES) && !EE_QUEUE_write(&cursor[1], &not_written, 1U)) ||
+            !EE_QUEUE_write(cursor, &code, 1U))
+    {
+        return;
+    }
+
+    last += delta;
+    cursor++;
+    entry++;
+}
+
+#endif
@@ -0,0 +1,78 @@
+/*!
+ * \file
+ * \brief Persistent temperature log header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app_config.h"
+
+/*!
+ *
+ * \addtogroup log
+ * \ingroup MiniThermometer
+ * \brief Temperature log kept in EEPROM, sent over the console after 'l'
+ * command
+ *
+ * \note The log is a ring of LOG_BLOCKS blocks. Block header holds sequence
+ * number, RTC date and time and temperature of its first entry. One byte per
+ * closed 15 min bucket of the history follows, with the change of its mean
+ * in 1/4 of degree. Each entry is queued for writing once it's taken, right
+ * after the following entry is cleared, so a block always ends with a not
+ * written entry and power loss costs at most the bucket in progress. Each
+ * byte is written twice per turn of the ring. After reset the block with the newest sequence number is
+ * found and logging continues in a new block. Blocks are opened only while
+ * RTC has a valid date.
+ *
+ * Dump is LOG_MAGIC, LOG_BLOCKS, LOG_BLOCK_SIZE and LOG_PERIOD_MINUTES
+ * followed by the raw blocks, see scripts/log_dump.py. It's queued in the
+ * serial buffer a chunk at a time, so it takes a few passes.
+ */
+
+/*@{*/
+
+#define LOG_BLOCKS                  (12U)
+#define LOG_BLOCK_SIZE              (32U)
+#define LOG_PERIOD_MINUTES          (15U)
+#define LOG_MAGIC                   (0x4CU)
+
+#if LOG_ENABLED
+/*!
+ * \brief Finds the newest block and registers the dump command
+ */
+void LOG_initialize(void);
+
+/*!
+ * \brief Appends entry, shall be called every LOG_PERIOD_MINUTES
+ *
+ * \param is_valid false when there was no temperature in the period
+ * \param temperature mean temperature of the period in units of the sensor
+ */
+void LOG_add(bool is_valid, int16_t temperature);
+#else
+#define LOG_initialize()            do {} while(0)
+#define LOG_add(is_valid, temperature) do {} while(0)
+#endif
+
+/*@}*/
+#endif /* end of LOG_H */
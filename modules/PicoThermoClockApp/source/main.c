@@ -40,11 +40,45 @@
 #include "input_mgr.h"
 #include "stat.h"
 #include "common.h"
+#include "uptime.h"
+#include "button.h"
+
+#if !defined HOST
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#endif
 
 /* \todo (DB) add static assert for checking CHAR_BIT == 8U */
 
 static SSD_MGR_displays_t displays[4];
 
+/*
+ * Halts the CPU until the next interrupt, unless the system timer ticked
+ * since the scheduler pass started, as a task might have become due then.
+ * The check and the sleep run with interrupts disabled, sei takes effect
+ * after the next instruction, so a tick can't slip in between them. Timers
+ * and the display multiplexing keep running in idle mode.
+ */
+static inline void idle(uint32_t pass_start)
+{
+#if defined HOST
+    (void)pass_start;
+#else
+    cli();
+
+    if(UPTIME_get_ms() == pass_start)
+    {
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_enable();
+        sei();
+        sleep_cpu();
+        sleep_disable();
+    }
+
+    sei();
+#endif
+}
+
 static inline void drivers_init(void)
 {
     GPIO_configure(true);
@@ -68,9 +102,15 @@ static inline void drivers_init(void)
 static inline void modules_init(void)
 {
     STAT_initialize();
+#if !DISPLAY_MUX_ENABLED
     SSD_MGR_initialize();
+#endif
     WIRE_MGR_initialize();
+#if INPUT_CAPTURE_ENABLED
+    BUTTON_initialize();
+#else
     INPUT_MGR_initialize();
+#endif
 }
 
 int main(void)
@@ -88,12 +128,19 @@ int main(void)
 
     APP_initialize(displays, displays_size);
 
+#if BENCHMARK_ENABLED
+    APP_benchmark();
+#endif
+
     DEBUG(DL_INFO, "%s", "********************************\n");
     DEBUG(DL_INFO, "%s", "******* Mini Thermometer *******\n");
     DEBUG(DL_INFO, "%s", "********************************\n");
 
     while(true)
     {
+        const uint32_t pass_start = UPTIME_get_ms();
+
         SYSTEM_main();
+        idle(pass_start);
     }
 }
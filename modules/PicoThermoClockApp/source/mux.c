@@ -0,0 +1,231 @@
+/*!
+ * \file
+ * \brief Display multiplexer implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "mux.h"
+
+#if DISPLAY_MUX_ENABLED
+
+#if defined HOST
+#error "Multiplexer writes ports of the target, use SsdMgr"
+#endif
+
+#include "hardware.h"
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+
+#define SEG_A                       (1U << 0U)
+#define SEG_B                       (1U << 1U)
+#define SEG_C                       (1U << 2U)
+#define SEG_D                       (1U << 3U)
+#define SEG_E                       (1U << 4U)
+#define SEG_F                       (1U << 5U)
+#define SEG_G                       (1U << 6U)
+#define SEG_ALL                     (SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F | SEG_G)
+
+/* bit of the segment, if it's wired to the port */
+#define SEGMENT_BIT(segments, segment, port) \
+    ((((segments) & SEG_ ## segment) != 0U) && (SEGMENT_ ## segment ## _PORT == (port)) ? \
+     (1U << SEGMENT_ ## segment ## _PIN) : 0U)
+
+#define SEGMENTS_MASK(segments, port) \
+    (uint8_t)(SEGMENT_BIT(segments, A, port) | SEGMENT_BIT(segments, B, port) | \
+              SEGMENT_BIT(segments, C, port) | SEGMENT_BIT(segments, D, port) | \
+              SEGMENT_BIT(segments, E, port) | SEGMENT_BIT(segments, F, port) | \
+              SEGMENT_BIT(segments, G, port))
+
+#define SEGMENTS_PORTB_MASK         SEGMENTS_MASK(SEG_ALL, GPIO_PORTB)
+#define SEGMENTS_PORTC_MASK         SEGMENTS_MASK(SEG_ALL, GPIO_PORTC)
+
+/* lit segments, inversion is applied when the glyph is read out */
+#define GLYPH(segments) \
+    { .portb = SEGMENTS_MASK(segments, GPIO_PORTB), .portc = SEGMENTS_MASK(segments, GPIO_PORTC) }
+
+#define DISPLAYS_MASK               (uint8_t)((1U << DISPLAY0_PIN) | (1U << DISPLAY1_PIN) | \
+                                              (1U << DISPLAY2_PIN) | (1U << DISPLAY3_PIN))
+
+#define COLON_MASK                  (uint8_t)(1U << COLON_PIN)
+
+#if SSD_DISPLAYS_INVERTED
+#define SELECT(pin)                 (uint8_t)(DISPLAYS_MASK ^ (1U << (pin)))
+#define SELECT_NONE                 DISPLAYS_MASK
+#else
+#define SELECT(pin)                 (uint8_t)(1U << (pin))
+#define SELECT_NONE                 (0U)
+#endif
+
+typedef struct
+{
+    uint8_t portb;
+    uint8_t portc;
+} glyph_t;
+
+/* displays and colon are written together with segment G, they must be on PORTB */
+typedef char displays_on_portb[((DISPLAY0_PORT == GPIO_PORTB) && (DISPLAY1_PORT == GPIO_PORTB) &&
+        (DISPLAY2_PORT == GPIO_PORTB) && (DISPLAY3_PORT == GPIO_PORTB) &&
+        (COLON_PORT == GPIO_PORTB)) ? 1 : -1];
+
+static const glyph_t glyphs[] PROGMEM =
+{
+    [SSD_DIGIT_0] =             GLYPH(SEG_A | SEG_B | SEG_C | SEG_D | SEG_E | SEG_F),
+    [SSD_DIGIT_1] =             GLYPH(SEG_B | SEG_C),
+    [SSD_DIGIT_2] =             GLYPH(SEG_A | SEG_B | SEG_D | SEG_E | SEG_G),
+    [SSD_DIGIT_3] =             GLYPH(SEG_A | SEG_B | SEG_C | SEG_D | SEG_G),
+    [SSD_DIGIT_4] =             GLYPH(SEG_B | SEG_C | SEG_F | SEG_G),
+    [SSD_DIGIT_5] =             GLYPH(SEG_A | SEG_C | SEG_D | SEG_F | SEG_G),
+    [SSD_DIGIT_6] =             GLYPH(SEG_A | SEG_C | SEG_D | SEG_E | SEG_F | SEG_G),
+    [SSD_DIGIT_7] =             GLYPH(SEG_A | SEG_B | SEG_C),
+    [SSD_DIGIT_8] =             GLYPH(SEG_ALL),
+    [SSD_DIGIT_9] =             GLYPH(SEG_A | SEG_B | SEG_C | SEG_D | SEG_F | SEG_G),
+    [SSD_CHAR_A] =              GLYPH(SEG_A | SEG_B | SEG_C | SEG_E | SEG_F | SEG_G),
+    [SSD_CHAR_C] =              GLYPH(SEG_A | SEG_D | SEG_E | SEG_F),
+    [SSD_CHAR_E] =              GLYPH(SEG_A | SEG_D | SEG_E | SEG_F | SEG_G),
+    [SSD_CHAR_F] =              GLYPH(SEG_A | SEG_E | SEG_F | SEG_G),
+    [SSD_CHAR_P] =              GLYPH(SEG_A | SEG_B | SEG_E | SEG_F | SEG_G),
+    [SSD_CHAR_h] =              GLYPH(SEG_C | SEG_E | SEG_F | SEG_G),
+    [SSD_CHAR_r] =              GLYPH(SEG_E | SEG_G),
+    [SSD_SYMBOL_MINUS] =        GLYPH(SEG_G),
+    [SSD_BLANK] =               GLYPH(0U),
+};
+
+static const uint8_t selects[MUX_DISPLAYS_COUNT] PROGMEM =
+{
+    SELECT(DISPLAY0_PIN),
+    SELECT(DISPLAY1_PIN),
+    SELECT(DISPLAY2_PIN),
+    SELECT(DISPLAY3_PIN),
+};
+
+typedef struct
+{
+    glyph_t glyphs[MUX_DISPLAYS_COUNT];
+    uint8_t blinking;
+    uint8_t colon;
+} buffer_t;
+
+static buffer_t buffers[2];
+/* swapped by the interrupt, the application renders into back */
+static buffer_t *volatile front = &buffers[0];
+static buffer_t *volatile back = &buffers[1];
+static volatile bool is_pending;
+static uint8_t select[MUX_DISPLAYS_COUNT];
+static glyph_t blank;
+static uint8_t current;
+static uint8_t scan;
+static volatile uint8_t brightness = MUX_BRIGHTNESS_LEVELS;
+static uint16_t blink_counter;
+static bool is_blink_off;
+
+static glyph_t get_glyph(uint8_t symbol)
+{
+    glyph_t glyph = { .portb = 0U, .portc = 0U };
+
+    if(symbol < (sizeof(glyphs)/sizeof(glyphs[0])))
+    {
+        memcpy_P(&glyph, &glyphs[symbol], sizeof(glyph));
+    }
+
+#if SSD_SEGMENTS_INVERTED
+    glyph.portb ^= SEGMENTS_PORTB_MASK;
+    glyph.portc ^= SEGMENTS_PORTC_MASK;
+#endif
+
+    return glyph;
+}
+
+void MUX_initialize(void)
+{
+    blank = get_glyph(SSD_BLANK);
+
+    for(uint8_t i = 0U; i < MUX_DISPLAYS_COUNT; i++)
+    {
+        buffers[0].glyphs[i] = blank;
+        select[i] = pgm_read_byte(&selects[i]);
+    }
+}
+
+void MUX_tick(void)
+{
+    current = (current + 1U) & (MUX_DISPLAYS_COUNT - 1U);
+
+    if(current == 0U)
+    {
+        scan++;
+
+        /* new frame is taken only before the first display */
+        if(is_pending)
+        {
+            buffer_t *tmp = front;
+
+            front = back;
+            back = tmp;
+            is_pending = false;
+        }
+    }
+
+    if(++blink_counter >= MUX_BLINK_HALF_PERIOD)
+    {
+        blink_counter = 0U;
+        is_blink_off = !is_blink_off;
+    }
+
+    /* dimmed displays are lit in brightness scans out of MUX_BRIGHTNESS_LEVELS */
+    if((scan & (MUX_BRIGHTNESS_LEVELS - 1U)) >= brightness)
+    {
+        PORTB = (uint8_t)((PORTB & (uint8_t)~(DISPLAYS_MASK | COLON_MASK)) | SELECT_NONE);
+        return;
+    }
+
+    const buffer_t *buffer = front;
+    const glyph_t *glyph = (is_blink_off && ((buffer->blinking & (1U << current)) != 0U)) ?
+        &blank : &buffer->glyphs[current];
+
+    PORTC = (uint8_t)((PORTC & (uint8_t)~SEGMENTS_PORTC_MASK) | glyph->portc);
+    PORTB = (uint8_t)((PORTB & (uint8_t)~(SEGMENTS_PORTB_MASK | DISPLAYS_MASK | COLON_MASK)) |
+            glyph->portb | select[current] | buffer->colon);
+}
+
+void MUX_show(const MUX_frame_t *frame)
+{
+    /* interrupt doesn't swap the buffers while back is being rendered */
+    is_pending = false;
+
+    buffer_t *buffer = back;
+
+    for(uint8_t i = 0U; i < MUX_DISPLAYS_COUNT; i++)
+    {
+        buffer->glyphs[i] = get_glyph(frame->symbols[i]);
+    }
+
+    buffer->blinking = frame->blinking;
+    buffer->colon = frame->is_colon ? COLON_MASK : 0U;
+
+    /* the buffer is complete in memory before the interrupt may take it */
+    __asm__ __volatile__("" ::: "memory");
+    is_pending = true;
+}
+
+void MUX_set_brightness(uint8_t level)
+{
+    brightness = ((level == 0U) || (level > MUX_BRIGHTNESS_LEVELS)) ? MUX_BRIGHTNESS_LEVELS : level;
+}
+
+#endif
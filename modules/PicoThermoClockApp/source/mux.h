@@ -0,0 +1,90 @@
+/*!
+ * \file
+ * \brief Display multiplexer header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef MUX_H
+#define MUX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app_config.h"
+
+/*!
+ *
+ * \addtogroup mux
+ * \ingroup MiniThermometer
+ * \brief Multiplexes the displays with port masks of the glyphs computed at
+ * build time for the board
+ *
+ * \note A frame is turned into PORTB and PORTC values of its symbols in a
+ * back buffer, which replaces the front buffer only before the first
+ * display of a scan, so a scan never mixes two frames. One step of the scan
+ * is a masked write of each port. Segment G, the colon and the display
+ * selects share PORTB and go out in the same write. Steps are made from the
+ * system timer callback, one display per millisecond. Brightness is set by
+ * leaving the displays off for some of the scans. When the multiplexer
+ * is disabled SsdMgr drives the displays.
+ */
+
+/*@{*/
+
+#define MUX_DISPLAYS_COUNT          (4U)
+#define MUX_BLINK_HALF_PERIOD       (500U)
+#define MUX_BRIGHTNESS_LEVELS       (4U)
+
+typedef struct
+{
+    uint8_t symbols[MUX_DISPLAYS_COUNT];
+    uint8_t blinking;
+    bool is_colon;
+} MUX_frame_t;
+
+#if DISPLAY_MUX_ENABLED
+void MUX_initialize(void);
+
+/*!
+ * \brief Lights the next display, shall be called from the system timer
+ * callback
+ */
+void MUX_tick(void);
+
+/*!
+ * \brief Renders the frame into the back buffer, which is shown from the
+ * start of the next scan
+ *
+ * \param frame symbols as in SSD_MGR_display_set, bit n of blinking makes
+ * the display n blink
+ */
+void MUX_show(const MUX_frame_t *frame);
+
+/*!
+ * \brief Sets brightness of the displays
+ *
+ * \param level 1 to MUX_BRIGHTNESS_LEVELS, full brightness when out of range
+ */
+void MUX_set_brightness(uint8_t level);
+#else
+#define MUX_tick()                  do {} while(0)
+#define MUX_set_brightness(level)   do {} while(0)
+#endif
+
+/*@}*/
+#endif /* end of MUX_H */
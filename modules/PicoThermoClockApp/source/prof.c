@@ -0,0 +1,295 @@
+/*!
+ * \file
+ * \brief Task profiler implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "prof.h"
+
+#if PROFILER_ENABLED
+
+#if BENCHMARK_ENABLED
+#error "Profiler and benchmark both use Timer1, enable only one of them"
+#endif
+
+#include "console.h"
+#include "uptime.h"
+#include "debug.h"
+#include <avr/pgmspace.h>
+#include <stdbool.h>
+
+#include "hardware.h"
+#if defined HOST
+#include "host.h"
+#else
+#include <avr/io.h>
+#endif
+
+/* Timer1 runs at clk/64, one tick is 4 us at 16 MHz */
+#define TICK_US                     ((64UL * 1000000UL) / F_CPU)
+#define TICKS_PER_MS                ((uint16_t)(1000U / TICK_US))
+#define PERCENT                     (100U)
+#define LINES_PER_TASK              (3U)
+
+typedef struct
+{
+    const char *name;
+    SYSTEM_task_t task;
+    uint16_t period;
+    bool is_started;
+    uint16_t last_start;
+    uint16_t min;
+    uint16_t max;
+    uint16_t runs;
+    uint32_t sum;
+    uint16_t jitter[PROF_JITTER_BINS];
+} task_stat_t;
+
+/* upper limits of the jitter histogram bins in ticks, last bin is open */
+static const uint16_t jitter_limits[PROF_JITTER_BINS - 1U] PROGMEM =
+{
+    100U / TICK_US,
+    500U / TICK_US,
+    1000U / TICK_US,
+    2000U / TICK_US,
+    5000U / TICK_US,
+    10000U / TICK_US,
+};
+
+static task_stat_t stats[PROF_MAX_TASKS];
+static uint8_t stats_count;
+static uint32_t busy;
+static uint32_t window_start;
+static uint8_t report_line;
+
+/* free running 16 bit counter, differences are valid up to 262 ms */
+static uint16_t get_ticks(void)
+{
+#if defined HOST
+    return (uint16_t)(HOST_get_uptime_us() / TICK_US);
+#else
+    return TCNT1;
+#endif
+}
+
+static void record_jitter(task_stat_t *stat, uint16_t start)
+{
+    if(stat->is_started)
+    {
+        const uint16_t expected = stat->period * TICKS_PER_MS;
+        const uint16_t interval = start - stat->last_start;
+        const uint16_t jitter = (interval > expected) ?
+            (interval - expected) : (expected - interval);
+        uint8_t bin = 0U;
+
+        while((bin < (PROF_JITTER_BINS - 1U)) &&
+                (jitter >= pgm_read_word(&jitter_limits[bin])))
+        {
+            bin++;
+        }
+
+        if(stat->jitter[bin] != UINT16_MAX)
+        {
+            stat->jitter[bin]++;
+        }
+    }
+
+    stat->is_started = true;
+    stat->last_start = start;
+}
+
+static void record_time(task_stat_t *stat, uint16_t time)
+{
+    if(time < stat->min)
+    {
+        stat->min = time;
+    }
+
+    if(time > stat->max)
+    {
+        stat->max = time;
+    }
+
+    if(stat->runs == UINT16_MAX)
+    {
+        /* halving keeps the average and makes room for new runs */
+        stat->sum /= 2U;
+        stat->runs /= 2U;
+    }
+
+    stat->sum += time;
+    stat->runs++;
+    busy += time;
+}
+
+static void run(uint8_t id)
+{
+    task_stat_t *stat = &stats[id];
+    const uint16_t start = get_ticks();
+
+    stat->task();
+
+    record_time(stat, get_ticks() - start);
+    record_jitter(stat, start);
+}
+
+#define TRAMPOLINE(id) static void trampoline_##id(void) { run(id##U); }
+
+TRAMPOLINE(0)
+TRAMPOLINE(1)
+
+static const SYSTEM_task_t trampolines[PROF_MAX_TASKS] =
+{
+    trampoline_0,
+    trampoline_1,
+};
+
+static bool reset(void)
+{
+    for(uint8_t i = 0U; i < stats_count; i++)
+    {
+        task_stat_t *stat = &stats[i];
+
+        stat->is_started = false;
+        stat->min = UINT16_MAX;
+        stat->max = 0U;
+        stat->sum = 0U;
+        stat->runs = 0U;
+
+        for(uint8_t j = 0U; j < PROF_JITTER_BINS; j++)
+        {
+            stat->jitter[j] = 0U;
+        }
+    }
+
+    busy = 0U;
+    window_start = UPTIME_get_ms();
+    return true;
+}
+
+static void write_field(const char *name, uint32_t value)
+{
+    CONSOLE_write_char(' ');
+    CONSOLE_write_P(name);
+    CONSOLE_write_char(' ');
+    CONSOLE_write_number(value);
+}
+
+static void write_task_line(const task_stat_t *stat, uint8_t line)
+{
+    CONSOLE_write_P(PSTR("PROF "));
+    CONSOLE_write_P(stat->name);
+
+    if(line == 0U)
+    {
+        write_field(PSTR("period"), stat->period);
+        write_field(PSTR("runs"), stat->runs);
+    }
+    else if(line == 1U)
+    {
+        const uint16_t avg = (stat->runs != 0U) ? (uint16_t)(stat->sum / stat->runs) : 0U;
+
+        write_field(PSTR("min"), (stat->runs != 0U) ? (stat->min * TICK_US) : 0U);
+        write_field(PSTR("max"), stat->max * TICK_US);
+        write_field(PSTR("avg"), avg * TICK_US);
+    }
+    else
+    {
+        CONSOLE_write_P(PSTR(" jitter"));
+
+        for(uint8_t j = 0U; j < PROF_JITTER_BINS; j++)
+        {
+            CONSOLE_write_char(' ');
+            CONSOLE_write_number(stat->jitter[j]);
+        }
+    }
+}
+
+static void write_idle_line(void)
+{
+    const uint32_t window = UPTIME_get_ms() - window_start;
+    uint32_t busy_ms = busy / TICKS_PER_MS;
+
+    if(busy_ms > window)
+    {
+        busy_ms = window;
+    }
+
+    CONSOLE_write_P(PSTR("PROF idle "));
+    CONSOLE_write_number((window != 0U) ? (PERCENT - ((busy_ms * PERCENT) / window)) : PERCENT);
+    write_field(PSTR("window"), window);
+}
+
+/* sends one line per pass, so the profiled task never waits for the USART */
+static bool report(void)
+{
+    if(!CONSOLE_flush())
+    {
+        return false;
+    }
+
+    if(report_line > (stats_count * LINES_PER_TASK))
+    {
+        report_line = 0U;
+        return true;
+    }
+
+    if(report_line == (stats_count * LINES_PER_TASK))
+    {
+        write_idle_line();
+    }
+    else
+    {
+        write_task_line(&stats[report_line / LINES_PER_TASK], report_line % LINES_PER_TASK);
+    }
+
+    CONSOLE_write_char('\n');
+    (void)CONSOLE_flush();
+    report_line++;
+    return false;
+}
+
+void PROF_initialize(void)
+{
+#if !defined HOST
+    TCCR1A = 0U;
+    TCNT1 = 0U;
+    TCCR1B = (1U << CS11) | (1U << CS10);
+#endif
+
+    (void)reset();
+    CONSOLE_register_command('p', report);
+    CONSOLE_register_command('r', reset);
+}
+
+void PROF_register_task(const char *name, SYSTEM_task_t task, uint16_t period)
+{
+    ASSERT(stats_count < PROF_MAX_TASKS);
+
+    task_stat_t *stat = &stats[stats_count];
+
+    stat->name = name;
+    stat->task = task;
+    stat->period = period;
+    stat->min = UINT16_MAX;
+    SYSTEM_register_task(trampolines[stats_count], period);
+    stats_count++;
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*!
+ * \file
+ * \brief Task profiler header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef PROF_H
+#define PROF_H
+
+#include <stdint.h>
+#include "app_config.h"
+#include "system.h"
+
+/*!
+ *
+ * \addtogroup prof
+ * \ingroup MiniThermometer
+ * \brief Measures execution time and start jitter of the tasks and the CPU
+ * load, report is sent over the console after 'p' command, 'r' clears it
+ *
+ * \note Tasks are wrapped with a trampoline which timestamps the start and the
+ * end of each run. Time spent in interrupts is attributed to the task they
+ * preempted, the rest is counted as idle. On the target the profiler owns
+ * Timer1 (clk/64) as free running counter, so runs and periods up to 262 ms
+ * are measured and it can't be enabled together with the benchmark.
+ */
+
+/*@{*/
+
+#define PROF_MAX_TASKS              (2U)
+#define PROF_JITTER_BINS            (7U)
+
+#if PROFILER_ENABLED
+void PROF_initialize(void);
+
+/*!
+ * \brief Registers profiled periodic task
+ *
+ * \param name name of the task stored in program space
+ * \param task task to be called
+ * \param period period of the task in milliseconds
+ */
+void PROF_register_task(const char *name, SYSTEM_task_t task, uint16_t period);
+#else
+#define PROF_initialize()           do {} while(0)
+#define PROF_register_task(name, task, period) SYSTEM_register_task((task), (period))
+#endif
+
+/*@}*/
+#endif /* end of PROF_H */
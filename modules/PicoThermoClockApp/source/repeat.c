@@ -0,0 +1,68 @@
+/*!
+ * \file
+ * \brief Auto-repeat of held buttons implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "repeat.h"
+#include <avr/pgmspace.h>
+#include <stdbool.h>
+
+static uint16_t next;
+static uint16_t interval;
+static bool is_started;
+
+void REPEAT_start(uint16_t now)
+{
+    next = now;
+    is_started = false;
+}
+
+uint8_t REPEAT_get_steps(const REPEAT_config_t *config, uint16_t now)
+{
+    REPEAT_config_t tmp;
+    uint8_t steps = 0U;
+
+    memcpy_P(&tmp, config, sizeof(tmp));
+
+    if(!is_started)
+    {
+        is_started = true;
+        next += tmp.initial_delay;
+        interval = tmp.start_interval;
+        return tmp.step;
+    }
+
+    while(((int16_t)(now - next) >= 0) && (steps < REPEAT_MAX_STEPS))
+    {
+        steps += (interval <= tmp.min_interval) ? tmp.fast_step : tmp.step;
+        next += interval;
+
+        if(interval >= (tmp.min_interval + tmp.acceleration))
+        {
+            interval -= tmp.acceleration;
+        }
+        else
+        {
+            interval = tmp.min_interval;
+        }
+    }
+
+    return steps;
+}
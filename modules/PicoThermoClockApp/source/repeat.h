@@ -0,0 +1,72 @@
+/*!
+ * \file
+ * \brief Auto-repeat of held buttons header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef REPEAT_H
+#define REPEAT_H
+
+#include <stdint.h>
+
+/*!
+ *
+ * \addtogroup repeat
+ * \ingroup MiniThermometer
+ * \brief Turns a held button into steps of an edited value
+ *
+ * \note First step is made when the long press is detected, next one after
+ * initial_delay. Then the interval between steps shrinks by acceleration
+ * down to min_interval, where fast_step is used instead of step. Times are
+ * 16-bit milliseconds of uptime, so a single interval must stay below 32 s.
+ */
+
+/*@{*/
+
+#define REPEAT_MAX_STEPS            (60U)
+
+typedef struct
+{
+    uint16_t initial_delay;
+    uint16_t start_interval;
+    uint16_t min_interval;
+    uint16_t acceleration;
+    uint8_t step;
+    uint8_t fast_step;
+} REPEAT_config_t;
+
+/*!
+ * \brief Starts counting of a new long press
+ *
+ * \param now time of the long press in milliseconds
+ */
+void REPEAT_start(uint16_t now);
+
+/*!
+ * \brief Returns number of steps due since the previous call
+ *
+ * \param config configuration of the edited field, placed in flash
+ * \param now current time in milliseconds
+ *
+ * \retval number of steps, zero when the next step is not due yet
+ */
+uint8_t REPEAT_get_steps(const REPEAT_config_t *config, uint16_t now);
+
+/*@}*/
+#endif /* end of REPEAT_H */
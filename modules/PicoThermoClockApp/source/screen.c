@@ -0,0 +1,140 @@
+/*!
+ * \file
+ * \brief Display shadow implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "screen.h"
+#include "hardware.h"
+#include "debug.h"
+#include "mux.h"
+
+#define COLON_ON                    (0x01U)
+#define COLON_UNKNOWN               (0x02U)
+
+static SSD_MGR_displays_t *screen_displays;
+static uint8_t screen_size;
+static uint8_t shadow[SCREEN_DIGITS];
+static uint8_t dirty;
+static uint8_t blinking;
+static uint8_t blinking_shown;
+static uint8_t colon;
+static uint8_t colon_shown;
+
+void SCREEN_initialize(SSD_MGR_displays_t *displays, uint8_t size)
+{
+    ASSERT(size <= SCREEN_DIGITS);
+
+    screen_displays = displays;
+    screen_size = size;
+
+#if DISPLAY_MUX_ENABLED
+    MUX_initialize();
+#endif
+
+    for(uint8_t i = 0U; i < size; i++)
+    {
+        shadow[i] = SSD_BLANK;
+#if !DISPLAY_MUX_ENABLED
+        SSD_MGR_display_blink(&displays[i], false);
+#endif
+    }
+
+    dirty = (uint8_t)((1U << size) - 1U);
+    blinking = 0U;
+    blinking_shown = 0U;
+    colon = 0U;
+    colon_shown = COLON_UNKNOWN;
+}
+
+void SCREEN_set(uint8_t index, uint8_t symbol)
+{
+    if(shadow[index] != symbol)
+    {
+        shadow[index] = symbol;
+        dirty |= (uint8_t)(1U << index);
+    }
+}
+
+void SCREEN_set_blinking(uint8_t mask)
+{
+    blinking = mask;
+}
+
+void SCREEN_set_colon(bool is_on)
+{
+    colon = is_on ? COLON_ON : 0U;
+}
+
+#if DISPLAY_MUX_ENABLED
+/* whole frame goes to the multiplexer at once, colon included */
+static void flush_changes(void)
+{
+    MUX_frame_t frame;
+
+    for(uint8_t i = 0U; i < MUX_DISPLAYS_COUNT; i++)
+    {
+        frame.symbols[i] = (i < screen_size) ? shadow[i] : (uint8_t)SSD_BLANK;
+    }
+
+    frame.blinking = blinking;
+    frame.is_colon = (colon == COLON_ON);
+
+    MUX_show(&frame);
+}
+#else
+static void flush_changes(void)
+{
+    const uint8_t blinking_changed = blinking ^ blinking_shown;
+
+    if(colon != colon_shown)
+    {
+        GPIO_write_pin(GPIO_CHANNEL_COLON, colon == COLON_ON);
+    }
+
+    for(uint8_t i = 0U; i < screen_size; i++)
+    {
+        const uint8_t mask = (uint8_t)(1U << i);
+
+        if((dirty & mask) != 0U)
+        {
+            SSD_MGR_display_set(&screen_displays[i], shadow[i]);
+        }
+
+        if((blinking_changed & mask) != 0U)
+        {
+            SSD_MGR_display_blink(&screen_displays[i], (blinking & mask) != 0U);
+        }
+    }
+}
+#endif
+
+void SCREEN_flush(void)
+{
+    if((dirty == 0U) && (blinking == blinking_shown) && (colon == colon_shown))
+    {
+        return;
+    }
+
+    flush_changes();
+
+    dirty = 0U;
+    blinking_shown = blinking;
+    colon_shown = colon;
+}
@@ -0,0 +1,85 @@
+/*!
+ * \file
+ * \brief Display shadow header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd_mgr.h"
+
+/*!
+ *
+ * \addtogroup screen
+ * \ingroup MiniThermometer
+ * \brief Shadow of the displayed digits, blinking and colon
+ *
+ * \note The application draws into the shadow only. SCREEN_flush passes to
+ * SsdMgr the digits and blink states which changed since the previous flush
+ * and writes the colon pin only when it changes. With the multiplexer
+ * enabled a change hands the whole frame, colon included, to MUX_show
+ * instead. A pass which redraws the same screen does no display writes.
+ */
+
+/*@{*/
+
+#define SCREEN_DIGITS               (4U)
+
+/*!
+ * \brief Binds the shadow to the displays, all digits are written on the
+ * first flush
+ *
+ * \param displays displays created in SsdMgr
+ * \param size number of displays, up to SCREEN_DIGITS
+ */
+void SCREEN_initialize(SSD_MGR_displays_t *displays, uint8_t size);
+
+/*!
+ * \brief Sets symbol of a digit
+ *
+ * \param index index of the digit
+ * \param symbol symbol as in SSD_MGR_display_set
+ */
+void SCREEN_set(uint8_t index, uint8_t symbol);
+
+/*!
+ * \brief Sets which digits blink
+ *
+ * \param mask bit n set makes the digit n blink
+ */
+void SCREEN_set_blinking(uint8_t mask);
+
+/*!
+ * \brief Sets the colon
+ *
+ * \param is_on true lights the colon
+ */
+void SCREEN_set_colon(bool is_on);
+
+/*!
+ * \brief Passes changes of the shadow to the displays, shall be called at
+ * the end of the application pass
+ */
+void SCREEN_flush(void);
+
+/*@}*/
+#endif /* end of SCREEN_H */
@@ -0,0 +1,121 @@
+/*!
+ * \file
+ * \brief Filtered temperature sampling implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "sensor.h"
+#include "trace.h"
+#include "uptime.h"
+
+#define AVERAGE_SHIFT               (2U)
+/* far outside of what a DS18B20 reports, keeps the sum of the average in 16 bits */
+#define SAMPLE_LIMIT                (INT16_MAX / (int16_t)SENSOR_AVERAGE_SIZE)
+
+typedef char median_of_3[(SENSOR_MEDIAN_SIZE == 3U) ? 1 : -1];
+typedef char average_size_is_power_of_2[(SENSOR_AVERAGE_SIZE == (1U << AVERAGE_SHIFT)) ? 1 : -1];
+
+static int16_t samples[SENSOR_MEDIAN_SIZE];
+static int16_t medians[SENSOR_AVERAGE_SIZE];
+static int16_t sum;
+static uint8_t sample_idx;
+static uint8_t median_idx;
+static uint8_t failures = SENSOR_MAX_FAILURES;
+static uint16_t next;
+
+static int16_t get_median(void)
+{
+    int16_t low = samples[0];
+    int16_t high = samples[1];
+
+    if(low > high)
+    {
+        low = samples[1];
+        high = samples[0];
+    }
+
+    if(samples[2] < high)
+    {
+        high = samples[2];
+    }
+
+    return (low > high) ? low : high;
+}
+
+static void restart(int16_t value)
+{
+    samples[0] = value;
+    samples[1] = value;
+    samples[2] = value;
+
+    for(uint8_t i = 0U; i < SENSOR_AVERAGE_SIZE; i++)
+    {
+        medians[i] = value;
+    }
+
+    sum = (int16_t)(value << AVERAGE_SHIFT);
+}
+
+static void add_sample(int16_t value)
+{
+    if(failures >= SENSOR_MAX_FAILURES)
+    {
+        restart(value);
+    }
+
+    failures = 0U;
+
+    samples[sample_idx] = value;
+    sample_idx = (sample_idx + 1U == SENSOR_MEDIAN_SIZE) ? 0U : sample_idx + 1U;
+
+    const int16_t median = get_median();
+
+    sum += (int16_t)(median - medians[median_idx]);
+    medians[median_idx] = median;
+    median_idx = (median_idx + 1U) & (SENSOR_AVERAGE_SIZE - 1U);
+}
+
+void SENSOR_main(void)
+{
+    const uint16_t now = (uint16_t)UPTIME_get_ms();
+
+    if((int16_t)(now - next) < 0)
+    {
+        return;
+    }
+
+    int16_t value;
+
+    next = now + SENSOR_PERIOD;
+
+    if(TRACE_get_temperature(&value) && (value > -SAMPLE_LIMIT) && (value < SAMPLE_LIMIT))
+    {
+        add_sample(value);
+    }
+    else if(failures < SENSOR_MAX_FAILURES)
+    {
+        failures++;
+    }
+}
+
+bool SENSOR_get_temperature(int16_t *temperature)
+{
+    *temperature = sum >> AVERAGE_SHIFT;
+    return (failures < SENSOR_MAX_FAILURES);
+}
@@ -0,0 +1,67 @@
+/*!
+ * \file
+ * \brief Filtered temperature sampling header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SENSOR_H
+#define SENSOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup sensor
+ * \ingroup MiniThermometer
+ * \brief Samples the temperature on its own period and filters the samples
+ *
+ * \note A sample is taken from 1WireMgr every SENSOR_PERIOD, whatever screen
+ * is shown. It first passes a median of the last SENSOR_MEDIAN_SIZE samples,
+ * which drops single bad reads, then a moving average of the last
+ * SENSOR_AVERAGE_SIZE medians. Both are filled with the first sample, so the
+ * value is valid from the first read. After SENSOR_MAX_FAILURES failed reads
+ * in a row the value is invalid until the sensor answers again.
+ */
+
+/*@{*/
+
+#define SENSOR_PERIOD               (1000U)
+#define SENSOR_MEDIAN_SIZE          (3U)
+#define SENSOR_AVERAGE_SIZE         (4U)
+#define SENSOR_MAX_FAILURES         (3U)
+
+/*!
+ * \brief Takes a sample when it's due, shall be called from the application
+ * task
+ */
+void SENSOR_main(void);
+
+/*!
+ * \brief Returns the filtered temperature, doesn't touch the bus
+ *
+ * \param temperature temperature in units of the sensor
+ *
+ * \retval true temperature is valid
+ * \retval false no valid sample yet or the sensor failed
+ */
+bool SENSOR_get_temperature(int16_t *temperature);
+
+/*@}*/
+#endif /* end of SENSOR_H */
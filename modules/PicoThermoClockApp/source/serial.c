@@ -0,0 +1,100 @@
+/*!
+ * \file
+ * \brief Serial transmit buffer implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "serial.h"
+
+#if SERIAL_ENABLED
+
+#include <util/atomic.h>
+#if defined HOST
+#include "usart.h"
+#else
+#include <avr/io.h>
+#endif
+
+#define BUFFER_MASK                 (SERIAL_BUFFER_SIZE - 1U)
+
+typedef char buffer_size_is_power_of_2[((SERIAL_BUFFER_SIZE & BUFFER_MASK) == 0U) ? 1 : -1];
+
+static uint8_t buffer[SERIAL_BUFFER_SIZE];
+static uint8_t head;
+static uint8_t tail;
+
+void SERIAL_tick(void)
+{
+    if(head == tail)
+    {
+        return;
+    }
+
+#if defined HOST
+    HOST_usart_send(buffer[tail]);
+#else
+    if((UCSRA & (1U << UDRE)) == 0U)
+    {
+        return;
+    }
+
+    UDR = buffer[tail];
+#endif
+    tail = (tail + 1U) & BUFFER_MASK;
+}
+
+bool SERIAL_write(const uint8_t *data, uint8_t size)
+{
+    bool ret = false;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        const uint8_t room = (uint8_t)(BUFFER_MASK - ((head - tail) & BUFFER_MASK));
+
+        if(size <= room)
+        {
+            for(uint8_t i = 0U; i < size; i++)
+            {
+                buffer[head] = data[i];
+                head = (head + 1U) & BUFFER_MASK;
+            }
+
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+int8_t SERIAL_read(uint8_t *data)
+{
+#if defined HOST
+    return HOST_usart_receive(data);
+#else
+    if((UCSRA & (1U << RXC)) == 0U)
+    {
+        return -1;
+    }
+
+    *data = UDR;
+    return 0;
+#endif
+}
+
+#endif
@@ -0,0 +1,76 @@
+/*!
+ * \file
+ * \brief Serial transmit buffer header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SERIAL_H
+#define SERIAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app_config.h"
+
+/*!
+ *
+ * \addtogroup serial
+ * \ingroup MiniThermometer
+ * \brief Non-blocking USART transfer on top of the configured USART
+ *
+ * \note Bytes are queued in a RAM ring buffer and the system timer callback
+ * moves one byte per millisecond into the data register, when it's empty.
+ * Nothing waits for the line, so a full buffer refuses new data. Reception
+ * polls the data register as well, there is no receive interrupt.
+ */
+
+/*@{*/
+
+#if SERIAL_ENABLED
+/*!
+ * \brief Sends next queued byte, if transmitter is ready, shall be called
+ * from the system timer callback
+ */
+void SERIAL_tick(void);
+
+/*!
+ * \brief Queues bytes for sending, all of them or none
+ *
+ * \param data bytes to be sent
+ * \param size number of bytes
+ *
+ * \retval true bytes queued
+ * \retval false not enough room, nothing queued
+ */
+bool SERIAL_write(const uint8_t *data, uint8_t size);
+
+/*!
+ * \brief Receives single byte if there is any
+ *
+ * \param data storage for received byte
+ *
+ * \retval 0 byte received
+ * \retval -1 nothing to receive
+ */
+int8_t SERIAL_read(uint8_t *data);
+#else
+#define SERIAL_tick()               do {} while(0)
+#endif
+
+/*@}*/
+#endif /* end of SERIAL_H */
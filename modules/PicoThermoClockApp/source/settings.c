@@ -0,0 +1,180 @@
+/*!
+ * \file
+ * \brief Settings store implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "settings.h"
+#include "mux.h"
+#include "trace.h"
+#include "uptime.h"
+#include "ee_queue.h"
+#include <avr/eeprom.h>
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
+#include <stddef.h>
+#include <string.h>
+
+/* unit byte of the firmware before the store, 0 for Celsius and 1 for Fahrenheit */
+#define LEGACY_UNIT_ADDRESS         ((const uint8_t *)0)
+#define LEGACY_FAHRENHEIT           (1U)
+
+typedef struct
+{
+    uint8_t version;
+    uint8_t sequence;
+    SETTINGS_data_t data;
+    uint8_t crc;
+} record_t;
+
+/*
+ * First byte is kept for the unit of the older firmware, settings.c is the
+ * first source with EEPROM variables, so it's linked at address 0
+ */
+typedef struct
+{
+    uint8_t legacy_unit;
+    record_t slots[SETTINGS_SLOTS];
+} storage_t;
+
+static storage_t EEMEM storage;
+
+static const SETTINGS_data_t defaults PROGMEM =
+{
+    .is_fahrenheit = false,
+    .is_12h_mode = false,
+    .brightness = MUX_BRIGHTNESS_LEVELS,
+    .time_screen_timeout = 20U,
+    .temp_screen_timeout = 5U,
+};
+
+static record_t cache;     /* sequence number of the newest slot */
+static uint8_t slot = SETTINGS_SLOTS - 1U;
+static bool is_configured;
+static bool is_dirty;
+static uint16_t changed;
+
+static uint8_t get_crc(const record_t *record)
+{
+    const uint8_t *data = (const uint8_t *)record;
+    uint8_t crc = 0U;
+
+    for(uint8_t i = 0U; i < offsetof(record_t, crc); i++)
+    {
+        crc = _crc8_ccitt_update(crc, data[i]);
+    }
+
+    return crc;
+}
+
+static void commit(void)
+{
+    const uint8_t next = (slot + 1U == SETTINGS_SLOTS) ? 0U : slot + 1U;
+
+    cache.version = SETTINGS_VERSION;
+    cache.sequence++;
+    cache.crc = get_crc(&cache);
+
+    if(!EE_QUEUE_write(&storage.slots[next], &cache, sizeof(cache)))
+    {
+        /* stays dirty, written on a later pass */
+        cache.sequence--;
+        return;
+    }
+
+    slot = next;
+    is_dirty = false;
+}
+
+/* older firmware kept the unit in EEPROM and 12/24h mode in the RTC only */
+static void migrate(void)
+{
+    const uint8_t unit = eeprom_read_byte(LEGACY_UNIT_ADDRESS);
+
+    if(unit > LEGACY_FAHRENHEIT)
+    {
+        return;
+    }
+
+    DS1302_datetime_t datetime;
+
+    TRACE_get_datetime(&datetime);
+    cache.data.is_fahrenheit = unit;
+    cache.data.is_12h_mode = datetime.is_12h_mode;
+    is_configured = true;
+    is_dirty = true;
+}
+
+void SETTINGS_initialize(void)
+{
+    memcpy_P(&cache.data, &defaults, sizeof(cache.data));
+    cache.sequence = UINT8_MAX;
+
+    /* slots are written in a ring, sequence numbers of the valid ones are close */
+    for(uint8_t i = 0U; i < SETTINGS_SLOTS; i++)
+    {
+        record_t record;
+
+        eeprom_read_block(&record, &storage.slots[i], sizeof(record));
+
+        if((record.version != SETTINGS_VERSION) || (record.crc != get_crc(&record)))
+        {
+            continue;
+        }
+
+        if(!is_configured || ((int8_t)(record.sequence - cache.sequence) > 0))
+        {
+            cache = record;
+            slot = i;
+            is_configured = true;
+        }
+    }
+
+    if(!is_configured)
+    {
+        migrate();
+    }
+}
+
+void SETTINGS_main(void)
+{
+    if(is_dirty && ((uint16_t)((uint16_t)UPTIME_get_ms() - changed) >= SETTINGS_COMMIT_DELAY))
+    {
+        commit();
+    }
+}
+
+bool SETTINGS_get(SETTINGS_data_t *settings)
+{
+    *settings = cache.data;
+    return is_configured;
+}
+
+void SETTINGS_set(const SETTINGS_data_t *settings)
+{
+    if(is_configured && (memcmp(&cache.data, settings, sizeof(cache.data)) == 0))
+    {
+        return;
+    }
+
+    cache.data = *settings;
+    is_configured = true;
+    is_dirty = true;
+    changed = (uint16_t)UPTIME_get_ms();
+}
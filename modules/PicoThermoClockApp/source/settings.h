@@ -0,0 +1,90 @@
+/*!
+ * \file
+ * \brief Settings store header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup settings
+ * \ingroup MiniThermometer
+ * \brief Versioned, CRC checked settings record kept in a ring of EEPROM
+ * slots with a write-back cache in RAM
+ *
+ * \note The record is read once on start, the newest valid slot wins.
+ * Changes go to the cache and are written SETTINGS_COMMIT_DELAY after the
+ * last one into the slot following the newest, so a pass through the
+ * setting screens costs one record spread over SETTINGS_SLOTS slots. A
+ * record of another version or with a bad CRC is ignored. When there is no
+ * valid record, the unit byte of the older firmware at EEPROM address 0 is
+ * taken over, if it holds a unit.
+ */
+
+/*@{*/
+
+#define SETTINGS_VERSION            (1U)
+#define SETTINGS_SLOTS              (8U)
+#define SETTINGS_COMMIT_DELAY       (5000U)
+
+typedef struct
+{
+    uint8_t is_fahrenheit;
+    uint8_t is_12h_mode;
+    uint8_t brightness;             /*!< 1 to MUX_BRIGHTNESS_LEVELS */
+    uint8_t time_screen_timeout;    /*!< seconds */
+    uint8_t temp_screen_timeout;    /*!< seconds */
+} SETTINGS_data_t;
+
+/*!
+ * \brief Loads the newest valid record into the cache, the older unit byte
+ * or defaults when there is none
+ */
+void SETTINGS_initialize(void);
+
+/*!
+ * \brief Writes the cache when it's due, shall be called from the
+ * application task
+ */
+void SETTINGS_main(void);
+
+/*!
+ * \brief Returns cached settings
+ *
+ * \param settings settings to be filled
+ *
+ * \retval true settings were loaded or set since start
+ * \retval false defaults, the device isn't configured
+ */
+bool SETTINGS_get(SETTINGS_data_t *settings);
+
+/*!
+ * \brief Updates cached settings, they are written later if they changed
+ *
+ * \param settings new settings
+ */
+void SETTINGS_set(const SETTINGS_data_t *settings);
+
+/*@}*/
+#endif /* end of SETTINGS_H */
@@ -0,0 +1,204 @@
+/*!
+ * \file
+ * \brief Event trace recorder implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "trace.h"
+
+#if TRACE_ENABLED
+
+#include "serial.h"
+#include "uptime.h"
+
+#define HEADER_SIZE                 (6U)
+#define MAX_RECORD_SIZE             (HEADER_SIZE + 7U)
+
+static uint8_t dropped;
+static bool is_replay;
+
+static bool write_record(uint8_t type, const uint8_t *payload, uint8_t size)
+{
+    const uint32_t timestamp = UPTIME_get_ms();
+    uint8_t frame[MAX_RECORD_SIZE] =
+    {
+        TRACE_SYNC,
+        type,
+        (uint8_t)timestamp,
+        (uint8_t)(timestamp >> 8U),
+        (uint8_t)(timestamp >> 16U),
+        (uint8_t)(timestamp >> 24U),
+    };
+
+    for(uint8_t i = 0U; i < size; i++)
+    {
+        frame[HEADER_SIZE + i] = payload[i];
+    }
+
+    return SERIAL_write(frame, HEADER_SIZE + size);
+}
+
+static void record(uint8_t type, const uint8_t *payload)
+{
+    if(is_replay)
+    {
+        return;
+    }
+
+    /* lost records are reported before any newer one */
+    bool is_written = (dropped == 0U) || write_record(TRACE_OVERFLOW, &dropped, 1U);
+
+    if(is_written)
+    {
+        dropped = 0U;
+        is_written = write_record(type, payload, TRACE_get_payload_size(type));
+    }
+
+    if(!is_written && (dropped != UINT8_MAX))
+    {
+        dropped++;
+    }
+}
+
+uint8_t TRACE_get_payload_size(uint8_t type)
+{
+    switch(type)
+    {
+        case TRACE_INPUT:
+            return 2U;
+        case TRACE_TEMPERATURE:
+            return 3U;
+        case TRACE_DATETIME:
+            return 7U;
+        case TRACE_MINUTES:
+        case TRACE_HOURS:
+        case TRACE_OVERFLOW:
+            return 1U;
+        default:
+            return 0U;
+    }
+}
+
+void TRACE_initialize(void)
+{
+#if defined HOST
+    is_replay = TRACE_REPLAY_initialize();
+#endif
+}
+
+int8_t TRACE_get_input_event(INPUT_MGR_event_t *event)
+{
+#if defined HOST
+    if(is_replay)
+    {
+        return TRACE_REPLAY_get_input_event(event, UPTIME_get_ms());
+    }
+#endif
+
+#if INPUT_CAPTURE_ENABLED
+    const int8_t ret = BUTTON_get_event(event);
+#else
+    const int8_t ret = INPUT_MGR_get_event(event);
+#endif
+
+    if(ret == 0)
+    {
+        const uint8_t payload[] = { event->id, event->event };
+        record(TRACE_INPUT, payload);
+    }
+
+    return ret;
+}
+
+bool TRACE_get_temperature(int16_t *temperature)
+{
+#if defined HOST
+    if(is_replay)
+    {
+        return TRACE_REPLAY_get_temperature(temperature);
+    }
+#endif
+
+    const bool ret = WIRE_MGR_get_temperature(temperature);
+    const uint16_t value = ret ? (uint16_t)*temperature : 0U;
+    const uint8_t payload[] = { (uint8_t)ret, (uint8_t)value, (uint8_t)(value >> 8U) };
+
+    record(TRACE_TEMPERATURE, payload);
+    return ret;
+}
+
+void TRACE_get_datetime(DS1302_datetime_t *datetime)
+{
+#if defined HOST
+    if(is_replay)
+    {
+        TRACE_REPLAY_get_datetime(datetime);
+        return;
+    }
+#endif
+
+    DS1302_get(datetime);
+
+    const uint8_t flags = (datetime->is_12h_mode ? TRACE_12H_MODE_FLAG : 0U) |
+        (datetime->is_pm ? TRACE_PM_FLAG : 0U);
+    const uint8_t payload[] =
+    {
+        datetime->year,
+        datetime->month,
+        datetime->date,
+        (uint8_t)((datetime->weekday & TRACE_WEEKDAY_MASK) | flags),
+        datetime->hours,
+        datetime->min,
+        datetime->secs,
+    };
+
+    record(TRACE_DATETIME, payload);
+}
+
+uint8_t TRACE_get_minutes(void)
+{
+#if defined HOST
+    if(is_replay)
+    {
+        return TRACE_REPLAY_get_minutes();
+    }
+#endif
+
+    const uint8_t ret = DS1302_get_minutes();
+
+    record(TRACE_MINUTES, &ret);
+    return ret;
+}
+
+uint8_t TRACE_get_hours(bool is_12h_mode)
+{
+#if defined HOST
+    if(is_replay)
+    {
+        return TRACE_REPLAY_get_hours();
+    }
+#endif
+
+    const uint8_t ret = DS1302_get_hours(is_12h_mode);
+
+    record(TRACE_HOURS, &ret);
+    return ret;
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*!
+ * \file
+ * \brief Event trace recorder header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "app_config.h"
+#include "input_mgr.h"
+#include "button.h"
+#include "1wire_mgr.h"
+#include "ds1302.h"
+
+/*!
+ *
+ * \addtogroup trace
+ * \ingroup MiniThermometer
+ * \brief Records every input event, temperature and RTC read of the
+ * application with its timestamp into the transmit buffer of the serial
+ * module, which drains it over USART. On the host the same calls can be fed
+ * from a captured trace.
+ *
+ * Each record is framed as: TRACE_SYNC, type, timestamp (4 bytes, little
+ * endian, milliseconds of uptime), payload of the length fixed per type.
+ */
+
+/*@{*/
+
+#define TRACE_SYNC                  (0xA5U)
+
+#define TRACE_INPUT                 (1U) /*!< id, event */
+#define TRACE_TEMPERATURE           (2U) /*!< is_valid, temperature (2 bytes) */
+#define TRACE_DATETIME              (3U) /*!< year, month, date, weekday | flags, hours, min, secs */
+#define TRACE_MINUTES               (4U) /*!< minutes */
+#define TRACE_HOURS                 (5U) /*!< hours */
+#define TRACE_OVERFLOW              (6U) /*!< number of dropped records, saturated */
+
+#define TRACE_WEEKDAY_MASK          (0x0FU)
+#define TRACE_12H_MODE_FLAG         (0x40U)
+#define TRACE_PM_FLAG               (0x80U)
+
+#if TRACE_ENABLED
+void TRACE_initialize(void);
+
+/*!
+ * \brief Returns payload length of given record type, 0 for unknown ones
+ */
+uint8_t TRACE_get_payload_size(uint8_t type);
+
+int8_t TRACE_get_input_event(INPUT_MGR_event_t *event);
+bool TRACE_get_temperature(int16_t *temperature);
+void TRACE_get_datetime(DS1302_datetime_t *datetime);
+uint8_t TRACE_get_minutes(void);
+uint8_t TRACE_get_hours(bool is_12h_mode);
+#else
+#define TRACE_initialize()                  do {} while(0)
+#if INPUT_CAPTURE_ENABLED
+#define TRACE_get_input_event(event)        BUTTON_get_event(event)
+#else
+#define TRACE_get_input_event(event)        INPUT_MGR_get_event(event)
+#endif
+#define TRACE_get_temperature(temperature)  WIRE_MGR_get_temperature(temperature)
+#define TRACE_get_datetime(datetime)        DS1302_get(datetime)
+#define TRACE_get_minutes()                 DS1302_get_minutes()
+#define TRACE_get_hours(is_12h_mode)        DS1302_get_hours(is_12h_mode)
+#endif
+
+#if TRACE_ENABLED && defined HOST
+/*!
+ * \brief Starts replay of the trace file pointed by TRACE_REPLAY_FILE
+ * environment variable, if there is any
+ *
+ * \retval true replay is active, recording is disabled
+ * \retval false firmware works on its inputs
+ */
+bool TRACE_REPLAY_initialize(void);
+int8_t TRACE_REPLAY_get_input_event(INPUT_MGR_event_t *event, uint32_t now);
+bool TRACE_REPLAY_get_temperature(int16_t *temperature);
+void TRACE_REPLAY_get_datetime(DS1302_datetime_t *datetime);
+uint8_t TRACE_REPLAY_get_minutes(void);
+uint8_t TRACE_REPLAY_get_hours(void);
+#endif
+
+/*@}*/
+#endif /* end of TRACE_H */
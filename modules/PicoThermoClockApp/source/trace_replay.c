@@ -0,0 +1,214 @@
+/*!
+ * \file
+ * \brief Host replay of captured event traces
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "trace.h"
+
+#if TRACE_ENABLED
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HEADER_SIZE                 (6U)
+#define MAX_PAYLOAD_SIZE            (7U)
+
+typedef struct
+{
+    uint8_t type;
+    uint32_t timestamp;
+    uint8_t payload[MAX_PAYLOAD_SIZE];
+} record_t;
+
+static record_t *records;
+static size_t records_count;
+static size_t cursors[TRACE_OVERFLOW + 1U];
+
+static void append(const uint8_t *frame)
+{
+    record_t *tmp = realloc(records, (records_count + 1U) * sizeof(record_t));
+
+    if(tmp == NULL)
+    {
+        fprintf(stderr, "REPLAY: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    records = tmp;
+    record_t *record = &records[records_count];
+
+    record->type = frame[1];
+    record->timestamp = (uint32_t)frame[2] | ((uint32_t)frame[3] << 8U) |
+        ((uint32_t)frame[4] << 16U) | ((uint32_t)frame[5] << 24U);
+    memcpy(record->payload, &frame[HEADER_SIZE], TRACE_get_payload_size(frame[1]));
+    records_count++;
+
+    if(record->type == TRACE_OVERFLOW)
+    {
+        fprintf(stderr, "REPLAY: %u records lost at %u ms, replay is not exact\n",
+                record->payload[0], record->timestamp);
+    }
+}
+
+static void parse(const uint8_t *data, size_t size)
+{
+    size_t i = 0U;
+
+    while((i + HEADER_SIZE) <= size)
+    {
+        const uint8_t payload_size = TRACE_get_payload_size(data[i + 1U]);
+
+        if((data[i] != TRACE_SYNC) || (payload_size == 0U) ||
+                ((i + HEADER_SIZE + payload_size) > size))
+        {
+            /* garbage between records, e.g. debug output, resynchronize */
+            i++;
+            continue;
+        }
+
+        append(&data[i]);
+        i += HEADER_SIZE + payload_size;
+    }
+}
+
+static const record_t *get_next(uint8_t type)
+{
+    size_t *cursor = &cursors[type];
+
+    while((*cursor < records_count) && (records[*cursor].type != type))
+    {
+        (*cursor)++;
+    }
+
+    return (*cursor < records_count) ? &records[*cursor] : NULL;
+}
+
+static const record_t *consume(uint8_t type)
+{
+    const record_t *ret = get_next(type);
+
+    if(ret == NULL)
+    {
+        fprintf(stderr, "REPLAY: trace finished\n");
+        exit(EXIT_SUCCESS);
+    }
+
+    cursors[type]++;
+    return ret;
+}
+
+bool TRACE_REPLAY_initialize(void)
+{
+    const char *name = getenv("TRACE_REPLAY_FILE");
+
+    if(name == NULL)
+    {
+        return false;
+    }
+
+    FILE *file = fopen(name, "rb");
+
+    if(file == NULL)
+    {
+        fprintf(stderr, "REPLAY: cannot open %s\n", name);
+        exit(EXIT_FAILURE);
+    }
+
+    uint8_t *data = NULL;
+    size_t size = 0U;
+    uint8_t chunk[BUFSIZ];
+    size_t count;
+
+    while((count = fread(chunk, 1U, sizeof(chunk), file)) != 0U)
+    {
+        uint8_t *tmp = realloc(data, size + count);
+
+        if(tmp == NULL)
+        {
+            fprintf(stderr, "REPLAY: out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+
+        data = tmp;
+        memcpy(&data[size], chunk, count);
+        size += count;
+    }
+
+    (void)fclose(file);
+    parse(data, size);
+    free(data);
+
+    fprintf(stderr, "REPLAY: %zu records from %s\n", records_count, name);
+    return true;
+}
+
+int8_t TRACE_REPLAY_get_input_event(INPUT_MGR_event_t *event, uint32_t now)
+{
+    const record_t *record = get_next(TRACE_INPUT);
+
+    if((record == NULL) || ((int32_t)(now - record->timestamp) < 0))
+    {
+        return -1;
+    }
+
+    cursors[TRACE_INPUT]++;
+    event->id = record->payload[0];
+    event->event = record->payload[1];
+
+    fprintf(stderr, "REPLAY: %u ms (recorded %u ms) input %u event %u\n",
+            now, record->timestamp, event->id, event->event);
+    return 0;
+}
+
+bool TRACE_REPLAY_get_temperature(int16_t *temperature)
+{
+    const record_t *record = consume(TRACE_TEMPERATURE);
+
+    *temperature = (int16_t)((uint16_t)record->payload[1] | ((uint16_t)record->payload[2] << 8U));
+    return (record->payload[0] != 0U);
+}
+
+void TRACE_REPLAY_get_datetime(DS1302_datetime_t *datetime)
+{
+    const record_t *record = consume(TRACE_DATETIME);
+
+    datetime->year = record->payload[0];
+    datetime->month = record->payload[1];
+    datetime->date = record->payload[2];
+    datetime->weekday = record->payload[3] & TRACE_WEEKDAY_MASK;
+    datetime->is_12h_mode = ((record->payload[3] & TRACE_12H_MODE_FLAG) != 0U);
+    datetime->is_pm = ((record->payload[3] & TRACE_PM_FLAG) != 0U);
+    datetime->hours = record->payload[4];
+    datetime->min = record->payload[5];
+    datetime->secs = record->payload[6];
+}
+
+uint8_t TRACE_REPLAY_get_minutes(void)
+{
+    return consume(TRACE_MINUTES)->payload[0];
+}
+
+uint8_t TRACE_REPLAY_get_hours(void)
+{
+    return consume(TRACE_HOURS)->payload[0];
+}
+
+#endif
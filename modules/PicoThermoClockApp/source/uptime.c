@@ -0,0 +1,43 @@
+/*!
+ * \file
+ * \brief Uptime counter implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "uptime.h"
+#include <util/atomic.h>
+
+static volatile uint32_t uptime;
+
+void UPTIME_tick(void)
+{
+    uptime++;
+}
+
+uint32_t UPTIME_get_ms(void)
+{
+    uint32_t ret;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        ret = uptime;
+    }
+
+    return ret;
+}
@@ -0,0 +1,48 @@
+/*!
+ * \file
+ * \brief Uptime counter header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef UPTIME_H
+#define UPTIME_H
+
+#include <stdint.h>
+
+/*!
+ *
+ * \addtogroup uptime
+ * \ingroup MiniThermometer
+ * \brief Milliseconds since start, common time base of the application
+ */
+
+/*@{*/
+
+/*!
+ * \brief Counts a millisecond, shall be called from the system timer callback
+ */
+void UPTIME_tick(void);
+
+/*!
+ * \brief Returns milliseconds elapsed since start
+ */
+uint32_t UPTIME_get_ms(void);
+
+/*@}*/
+#endif /* end of UPTIME_H */
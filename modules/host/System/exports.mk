@@ -0,0 +1 @@
+GLOBAL_INCLUDE_DIR += modules/host/System/include
@@ -0,0 +1,60 @@
+/*!
+ * \file
+ * \brief Host stand-in of System module header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SYSTEM_H
+#define SYSTEM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*!
+ *
+ * \addtogroup system
+ * \ingroup host
+ * \brief Cooperative scheduler running tasks with millisecond periods
+ */
+
+/*@{*/
+
+#define SYSTEM_MAX_TASKS        (8U)
+
+typedef void (*SYSTEM_task_t)(void);
+
+void SYSTEM_init(void);
+
+/*!
+ * \brief Runs tasks which became due since the last call
+ */
+void SYSTEM_main(void);
+
+/*!
+ * \brief Registers periodic task
+ *
+ * \param task task to be called
+ * \param period period of the task in milliseconds
+ *
+ * \note Stand-in aborts the process when there is no room for the task
+ */
+void SYSTEM_register_task(SYSTEM_task_t task, uint16_t period);
+
+/*@}*/
+#endif /* end of SYSTEM_H */
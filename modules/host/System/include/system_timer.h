@@ -0,0 +1,59 @@
+/*!
+ * \file
+ * \brief Host stand-in of System timer header file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef SYSTEM_TIMER_H
+#define SYSTEM_TIMER_H
+
+#include <stdint.h>
+
+/*!
+ *
+ * \addtogroup system_timer
+ * \ingroup host
+ * \brief Millisecond timer, callbacks run as if they were called from the
+ * timer interrupt
+ */
+
+/*@{*/
+
+#define SYSTEM_TIMER_MAX_CALLBACKS  (8U)
+
+typedef void (*SYSTEM_timer_callback_t)(void);
+
+/*!
+ * \brief Registers callback called every millisecond
+ *
+ * \param callback callback to be called
+ *
+ * \note Stand-in aborts the process when there is no room for the callback
+ */
+void SYSTEM_timer_register(SYSTEM_timer_callback_t callback);
+
+/*!
+ * \brief Delivers timer interrupts for milliseconds elapsed since last call
+ *
+ * \return number of delivered interrupts
+ */
+uint32_t SYSTEM_timer_process(void);
+
+/*@}*/
+#endif /* end of SYSTEM_TIMER_H */
@@ -0,0 +1,119 @@
+/*!
+ * \file
+ * \brief Host stand-in of System module implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "system.h"
+#include "system_timer.h"
+#include "host.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct
+{
+    SYSTEM_task_t task;
+    uint16_t period;
+    uint16_t counter;
+    bool is_ready;
+} task_t;
+
+static task_t tasks[SYSTEM_MAX_TASKS];
+static uint8_t tasks_count;
+
+static uint32_t get_time_to_next_task(void)
+{
+    uint32_t ret = UINT16_MAX;
+
+    for(uint8_t i = 0U; i < tasks_count; i++)
+    {
+        const uint32_t remaining = (uint32_t)tasks[i].period - tasks[i].counter;
+
+        if(remaining < ret)
+        {
+            ret = remaining;
+        }
+    }
+
+    return ret;
+}
+
+static void tick(void)
+{
+    for(uint8_t i = 0U; i < tasks_count; i++)
+    {
+        task_t *task = &tasks[i];
+
+        task->counter++;
+
+        if(task->counter >= task->period)
+        {
+            task->counter = 0U;
+            task->is_ready = true;
+        }
+    }
+}
+
+void SYSTEM_init(void)
+{
+    SYSTEM_timer_register(tick);
+}
+
+void SYSTEM_main(void)
+{
+    bool is_idle = true;
+
+    (void)SYSTEM_timer_process();
+
+    for(uint8_t i = 0U; i < tasks_count; i++)
+    {
+        task_t *task = &tasks[i];
+
+        if(task->is_ready)
+        {
+            task->is_ready = false;
+            task->task();
+            is_idle = false;
+        }
+    }
+
+    if(is_idle)
+    {
+        HOST_idle(get_time_to_next_task());
+    }
+}
+
+void SYSTEM_register_task(SYSTEM_task_t task, uint16_t period)
+{
+    if((task == NULL) || (period == 0U) || (tasks_count >= SYSTEM_MAX_TASKS))
+    {
+        fprintf(stderr, "SYSTEM: task can't be registered\n");
+        abort();
+    }
+
+    tasks[tasks_count] = (task_t)
+    {
+        .task = task,
+        .period = period,
+        .counter = 0U,
+        .is_ready = false,
+    };
+    tasks_count++;
+}
@@ -0,0 +1,61 @@
+/*!
+ * \file
+ * \brief Host stand-in of System timer implementation file
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#include "system_timer.h"
+#include "host.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static SYSTEM_timer_callback_t callbacks[SYSTEM_TIMER_MAX_CALLBACKS];
+static uint8_t callbacks_count;
+static uint32_t last_tick;
+
+void SYSTEM_timer_register(SYSTEM_timer_callback_t callback)
+{
+    if((callback == NULL) || (callbacks_count >= SYSTEM_TIMER_MAX_CALLBACKS))
+    {
+        fprintf(stderr, "SYSTEM: timer callback can't be registered\n");
+        abort();
+    }
+
+    callbacks[callbacks_count] = callback;
+    callbacks_count++;
+}
+
+uint32_t SYSTEM_timer_process(void)
+{
+    const uint32_t now = HOST_get_time_ms();
+    const uint32_t elapsed = now - last_tick;
+
+    while(last_tick != now)
+    {
+        last_tick++;
+
+        for(uint8_t i = 0U; i < callbacks_count; i++)
+        {
+            callbacks[i]();
+        }
+    }
+
+    return elapsed;
+}
@@ -0,0 +1,86 @@
+/*!
+ * \file
+ * \brief PicoThermoClockApp build time configuration
+ * \author Dawid Babula
+ * \email dbabula@adventurous.pl
+ *
+ * \par Copyright (C) Dawid Babula, 2026
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef APP_CONFIG_H
+#define APP_CONFIG_H
+
+/*!
+ *
+ * \addtogroup app_config
+ * \ingroup MiniThermometer
+ * \brief Optional features, each can be overridden from the command line,
+ * e.g. make ... USER_CDEFS=TRACE_ENABLED=1
+ */
+
+/*@{*/
+
+/*! Records inputs, temperatures and RTC reads and drains them over USART */
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED               (0)
+#endif
+
+/*! Runs cycle counting of the hot paths instead of the application */
+#ifndef BENCHMARK_ENABLED
+#define BENCHMARK_ENABLED           (0)
+#endif
+
+/*! Buttons are captured by INT0/INT1 instead of being polled by InputMgr */
+#ifndef INPUT_CAPTURE_ENABLED
+#if defined HOST
+#define INPUT_CAPTURE_ENABLED       (0)
+#else
+#define INPUT_CAPTURE_ENABLED       (1)
+#endif
+#endif
+
+/*! Displays are multiplexed with precomputed port masks instead of SsdMgr */
+#ifndef DISPLAY_MUX_ENABLED
+#if defined HOST
+#define DISPLAY_MUX_ENABLED         (0)
+#else
+#define DISPLAY_MUX_ENABLED         (1)
+#endif
+#endif
+
+/*! Measures execution time of the tasks, report is sent on USART command */
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED            (0)
+#endif
+
+/*! Temperature log in EEPROM, dumped on USART command */
+#ifndef LOG_ENABLED
+#define LOG_ENABLED                 (1)
+#endif
+
+/*! Single character commands over USART, built only for the features which need it */
+#define CONSOLE_ENABLED             (PROFILER_ENABLED || LOG_ENABLED)
+
+/*! Non-blocking USART transfer, built only for the features which need it */
+#define SERIAL_ENABLED              (TRACE_ENABLED || CONSOLE_ENABLED)
+
+/*! Size of the serial transmit buffer in bytes, power of 2, at most 128 */
+#ifndef SERIAL_BUFFER_SIZE
+#define SERIAL_BUFFER_SIZE          (64U)
+#endif
+
+/*@}*/
+#endif /* end of APP_CONFIG_H */
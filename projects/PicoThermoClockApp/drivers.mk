@@ -1,5 +1,14 @@
+ifeq ($(TARGET),host)
+USED_DRIVERS += host/platform
+USED_DRIVERS += host/gpio
+USED_DRIVERS += common
+USED_DRIVERS += host/usart
+USED_DRIVERS += host/1wire
+USED_DRIVERS += host/ds1302
+else
 USED_DRIVERS += gpio
 USED_DRIVERS += common
 USED_DRIVERS += usart
 USED_DRIVERS += 1wire
 USED_DRIVERS += ds1302
+endif
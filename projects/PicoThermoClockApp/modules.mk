@@ -1,5 +1,9 @@
 USED_MODULES += Debug
+ifeq ($(TARGET),host)
+USED_MODULES += host/System
+else
 USED_MODULES += System
+endif
 USED_MODULES += SsdMgr
 USED_MODULES += 1WireMgr
 USED_MODULES += InputMgr
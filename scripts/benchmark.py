@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Runs the benchmark build of PicoThermoClockApp under simavr.
+
+The firmware reports "BENCH <name> <cycles>" lines over USART, simavr prints
+them on its output. Results are stored as JSON together with the commit they
+were measured on. Given a baseline file, differences are printed as well.
+
+    benchmark.py --elf build_.../bin/App.elf --output benchmark.json
+    benchmark.py --elf ... --output new.json --baseline old.json
+"""
+
+import argparse
+import json
+import re
+import subprocess
+import sys
+
+ANSI_ESCAPE = re.compile(r"\x1b\[[0-9;]*m")
+RESULT = re.compile(r"BENCH (\S+) (\d+)")
+
+
+def get_commit():
+    try:
+        return subprocess.check_output(["git", "rev-parse", "--short", "HEAD"],
+                                       text=True).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def run(args):
+    command = [args.simavr, "-m", args.mcu, "-f", str(args.frequency), args.elf]
+    process = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                             text=True, errors="replace", timeout=args.timeout)
+    results = {}
+    finished = False
+    for line in ANSI_ESCAPE.sub("", process.stdout).splitlines():
+        match = RESULT.search(line)
+        if match:
+            results[match.group(1)] = int(match.group(2))
+        elif "BENCH END" in line:
+            finished = True
+    if not finished:
+        sys.exit("benchmark did not finish:\n" + process.stdout)
+    return results
+
+
+def compare(results, baseline):
+    print("%-24s %10s %10s %8s" % ("case", "baseline", "cycles", "change"))
+    for name, cycles in results.items():
+        old = baseline.get(name)
+        if old:
+            print("%-24s %10u %10u %+7.1f%%" % (name, old, cycles, 100.0 * (cycles - old) / old))
+        else:
+            print("%-24s %10s %10u %8s" % (name, "-", cycles, "new"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--elf", required=True)
+    parser.add_argument("--output", required=True)
+    parser.add_argument("--baseline")
+    parser.add_argument("--mcu", default="atmega8")
+    parser.add_argument("--frequency", type=int, default=16000000)
+    parser.add_argument("--simavr", default="simavr")
+    parser.add_argument("--timeout", type=int, default=60)
+    args = parser.parse_args()
+
+    results = run(args)
+    report = {
+        "commit": get_commit(),
+        "mcu": args.mcu,
+        "frequency": args.frequency,
+        "cycles": results,
+    }
+    with open(args.output, "w") as output:
+        json.dump(report, output, indent=4, sort_keys=True)
+        output.write("\n")
+
+    if args.baseline:
+        with open(args.baseline) as baseline:
+            compare(results, json.load(baseline)["cycles"])
+    else:
+        for name, cycles in results.items():
+            print("%-24s %10u" % (name, cycles))
+
+
+if __name__ == "__main__":
+    main()
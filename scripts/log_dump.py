@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Reads PicoThermoClockApp temperature log dumped over USART.
+
+Sends the 'l' command, waits for the dump and prints the entries oldest first
+with their time and temperature. Without --port the dump is read from stdin,
+anything before it, e.g. debug output, is skipped.
+
+    log_dump.py --port /dev/ttyUSB0
+    log_dump.py < dump.bin
+"""
+
+import argparse
+import datetime
+import struct
+import sys
+
+MAGIC = 0x4C
+PREAMBLE_SIZE = 4
+# sequence, year, month, date, weekday, hours, min, secs, is_12h_mode, is_pm, base
+HEADER = struct.Struct("<B7B2?h")
+NOT_WRITTEN = 0xFF
+NO_SAMPLE = 0xFE
+DELTA_OFFSET = 128
+
+
+def read_dump(stream):
+    data = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            raise SystemExit("no complete dump received")
+        data += chunk
+        while len(data) >= PREAMBLE_SIZE:
+            magic, blocks, block_size, period = data[:PREAMBLE_SIZE]
+            if magic != MAGIC or blocks == 0 or block_size <= HEADER.size or period == 0:
+                del data[0]
+                continue
+            end = PREAMBLE_SIZE + blocks * block_size
+            if len(data) < end:
+                break
+            body = bytes(data[PREAMBLE_SIZE:end])
+            return [body[i:i + block_size] for i in range(0, len(body), block_size)], period
+
+
+def is_valid(block):
+    return 1 <= block[2] <= 12
+
+
+def ordered(blocks):
+    """Oldest block first, the newest one ends the run of sequence numbers from block 0."""
+    if not is_valid(blocks[0]):
+        return []
+    newest = 0
+    while (newest + 1 < len(blocks) and is_valid(blocks[newest + 1]) and
+           blocks[newest + 1][0] == (blocks[newest][0] + 1) & 0xFF):
+        newest += 1
+    order = list(range(newest + 1, len(blocks))) + list(range(newest + 1))
+    return [blocks[i] for i in order if is_valid(blocks[i])]
+
+
+def entries(block, period):
+    (_, year, month, date, _, hours, minutes, secs, is_12h_mode, is_pm,
+     value) = HEADER.unpack_from(block)
+    if is_12h_mode:
+        hours = hours % 12 + (12 if is_pm else 0)
+    time = datetime.datetime(2000 + year, month, date, hours, minutes, secs)
+    for code in block[HEADER.size:]:
+        if code == NOT_WRITTEN:
+            break
+        if code == NO_SAMPLE:
+            yield time, None
+        else:
+            value += code - DELTA_OFFSET
+            yield time, value / 4.0
+        time += datetime.timedelta(minutes=period)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", help="serial port, stdin when omitted")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.port:
+        import serial
+        stream = serial.Serial(args.port, args.baudrate, timeout=5)
+        stream.write(b"l")
+    else:
+        stream = sys.stdin.buffer
+
+    blocks, period = read_dump(stream)
+    for block in ordered(blocks):
+        for time, temperature in entries(block, period):
+            text = "%.2f C" % temperature if temperature is not None else "no sample"
+            print("%s %s" % (time.strftime("%Y-%m-%d %H:%M"), text))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""Fails the build when the firmware doesn't fit the flash and RAM of the MCU.
+
+Flash holds .text and the initial values of .data, RAM holds .data, .bss and
+.noinit and has to leave room for the stack.
+
+    size_check.py --elf build_.../bin/App.elf --mcu atmega8
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+# flash and RAM in bytes
+MEMORIES = {
+    "atmega8": (8192, 1024),
+    "atmega168": (16384, 1024),
+    "atmega328p": (32768, 2048),
+}
+
+SECTION = re.compile(r"^(\.\S+)\s+(\d+)\s+\d+")
+
+
+def get_sections(args):
+    output = subprocess.check_output([args.size, "-A", args.elf], text=True)
+    sections = {}
+    for line in output.splitlines():
+        match = SECTION.match(line)
+        if match:
+            sections[match.group(1)] = int(match.group(2))
+    return sections
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--elf", required=True)
+    parser.add_argument("--mcu", default="atmega8", choices=sorted(MEMORIES))
+    parser.add_argument("--size", default="avr-size")
+    parser.add_argument("--stack", type=int, default=128,
+                        help="RAM left for the stack in bytes")
+    args = parser.parse_args()
+
+    sections = get_sections(args)
+    flash = sections.get(".text", 0) + sections.get(".data", 0)
+    ram = sections.get(".data", 0) + sections.get(".bss", 0) + sections.get(".noinit", 0)
+    flash_size, ram_size = MEMORIES[args.mcu]
+    ram_limit = ram_size - args.stack
+
+    print("%-6s %6u of %6u bytes" % ("flash", flash, flash_size))
+    print("%-6s %6u of %6u bytes (%u left for the stack)" % ("RAM", ram, ram_size, args.stack))
+
+    if (flash > flash_size) or (ram > ram_limit):
+        sys.exit("%s doesn't fit %s" % (args.elf, args.mcu))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Captures PicoThermoClockApp event trace drained over USART.
+
+Valid trace records are stored in binary form, ready to be replayed by the
+host build (TRACE_REPLAY_FILE=<file>). Anything between records, e.g. debug
+output, is dropped. With --text records are printed in human readable form.
+
+    trace_capture.py --port /dev/ttyUSB0 trace.bin
+    trace_capture.py --text < trace.bin
+"""
+
+import argparse
+import struct
+import sys
+
+SYNC = 0xA5
+HEADER_SIZE = 6
+PAYLOAD_SIZE = {1: 2, 2: 3, 3: 7, 4: 1, 5: 1, 6: 1}
+NAMES = {1: "INPUT", 2: "TEMPERATURE", 3: "DATETIME", 4: "MINUTES", 5: "HOURS",
+         6: "OVERFLOW"}
+
+
+def records(stream):
+    data = bytearray()
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            break
+        data += chunk
+        while len(data) >= HEADER_SIZE:
+            size = PAYLOAD_SIZE.get(data[1])
+            if data[0] != SYNC or size is None:
+                del data[0]
+                continue
+            if len(data) < HEADER_SIZE + size:
+                break
+            yield bytes(data[:HEADER_SIZE + size])
+            del data[:HEADER_SIZE + size]
+
+
+def describe(record):
+    kind = record[1]
+    timestamp = struct.unpack_from("<I", record, 2)[0]
+    payload = record[HEADER_SIZE:]
+    if kind == 2:
+        valid, value = payload[0], struct.unpack_from("<h", payload, 1)[0]
+        text = "%.4f C" % (value / 16.0) if valid else "invalid"
+    elif kind == 3:
+        text = "20%02u-%02u-%02u %02u:%02u:%02u wd %u%s%s" % (
+            payload[0], payload[1], payload[2], payload[4], payload[5], payload[6],
+            payload[3] & 0x0F, " 12h" if payload[3] & 0x40 else "",
+            " pm" if payload[3] & 0x80 else "")
+    else:
+        text = " ".join(str(byte) for byte in payload)
+    return "%10u %-12s %s" % (timestamp, NAMES[kind], text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("output", nargs="?", help="binary trace file to write")
+    parser.add_argument("--port", help="serial port, stdin when omitted")
+    parser.add_argument("--baudrate", type=int, default=115200)
+    parser.add_argument("--text", action="store_true", help="print records")
+    args = parser.parse_args()
+
+    if args.port:
+        import serial
+        stream = serial.Serial(args.port, args.baudrate, timeout=1)
+    else:
+        stream = sys.stdin.buffer
+
+    output = open(args.output, "wb") if args.output else None
+    try:
+        for record in records(stream):
+            if output:
+                output.write(record)
+                output.flush()
+            if args.text or not output:
+                print(describe(record))
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if output:
+            output.close()
+
+
+if __name__ == "__main__":
+    main()